@@ -105,6 +105,15 @@ struct FieldVtxColorMgr : public J3DVtxColorCalc, public CNode {
 	FieldVtxColorControl* mControl; // _30
 	f32 mSmoothingRate;             // _34
 	BitFlag<u32> mMgrFlags;         // _38
+
+#if FOR_MODDING
+	// mInfo and vertex color index ranges covered by any control, only these can change in calc
+	int mDirtyInfoStart;  // _3C
+	int mDirtyInfoEnd;    // _40, exclusive
+	int mDirtyColorStart; // _44
+	int mDirtyColorEnd;   // _48, exclusive
+	int mTouchedVtxNum;   // _4C, vertex colors changed by the last calc
+#endif
 };
 } // namespace Game
 
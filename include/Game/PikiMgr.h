@@ -90,6 +90,11 @@ struct PikiMgr : public MonoObjectMgr<Piki> {
 	UpdateMgr* mUpdateMgr;         // _74
 	UpdateMgr* mUpdateMgr2;        // _78, unsure of type
 	JKRArchive* mModelArchive;     // _7C
+
+#if FOR_MODDING
+	Mtx* mHappaDrawMtx;   // _80, view matrices for doSimpleDraw, grouped by happa model
+	u8* mHappaDrawKind;   // _84, happa model per piki for doSimpleDraw, 0xFF = not drawn
+#endif
 };
 
 extern PikiMgr* pikiMgr;
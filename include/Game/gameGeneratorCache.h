@@ -4,6 +4,12 @@
 #include "types.h"
 #include "Game/gameGenerator.h"
 
+#if FOR_MODDING
+// First byte of a compact binary save. Legacy saves start with a course flag (0 or 255) instead.
+#define GENERATOR_CACHE_COMPACT_TAG     (0xC5)
+#define GENERATOR_CACHE_COMPACT_VERSION (3)
+#endif
+
 namespace Game {
 /// @size{0x3C}
 struct CourseCache : public CNode {
@@ -16,6 +22,12 @@ struct CourseCache : public CNode {
 	void read(Stream&);
 	void write(Stream&);
 
+#if FOR_MODDING
+	int getCompactSize(u32);
+	void readCompact(Stream&, u32);
+	void writeCompact(Stream&, u32);
+#endif
+
 	inline void* getOffsetBuffer(void* buffer, int offset) { return (void*)(((u32)buffer + mOffset + mGeneratorSize) + offset); }
 	inline void* getOffsetBufferNoGen(void* buffer, int offset) { return (void*)(((u32)buffer + mOffset) - offset); }
 
@@ -28,6 +40,9 @@ struct CourseCache : public CNode {
 	int mCreatureSize;   // _30
 	int mPikiheadCount;  // _34
 	int mPikiheadSize;   // _38
+#if FOR_MODDING
+	bool mIsPacked; // _3C, heap data is zero-run packed (see CacheStream)
+#endif
 };
 
 /// @size{0x140}
@@ -60,6 +75,12 @@ struct GeneratorCache {
 	void updateUseList();
 	void write(Stream&);
 
+#if FOR_MODDING
+	int getCompactSize();
+	void readCompact(Stream&);
+	void writeCompact(Stream&);
+#endif
+
 	inline int getHeapUsedSize() const { return mHeapSize - mFreeSize; }
 
 	CourseCache mRootCache;     // _00
@@ -59,6 +59,10 @@ struct ShadowNode : public CNode {
 	Creature* mCreature; // _18
 	Matrixf* mMatrices;  // _1C
 	u32 mFlags;          // _20 /* bitfield */
+
+#if FOR_MODDING
+	ShadowNode* mHashNext; // _24, next node in the same ShadowMgr::mShadowHash bucket
+#endif
 };
 
 // stripped struct
@@ -194,6 +198,10 @@ struct SphereShadowNode : public JointShadowNode {
 	// _00-_24 = JointShadowNode
 };
 
+#if FOR_MODDING
+#define SHADOW_HASH_SIZE (256) // must be a power of 2
+#endif
+
 // Size: 0x50
 struct ShadowMgr : public CNode {
 	ShadowMgr(int);
@@ -251,6 +259,13 @@ struct ShadowMgr : public CNode {
 
 	void setForceVisible(Creature*, bool);
 
+#if FOR_MODDING
+	ShadowNode* findShadowNode(Creature*);
+	void entryShadowNode(ShadowNode*);
+	void removeShadowNode(ShadowNode*);
+	void moveShadowNode(ShadowNode*, ShadowNode*);
+#endif
+
 	inline int getViewportCount() { return mViewportNum; }
 	CylinderBase* getActiveCylinder() { return mCylinders[mCylinderID]; }
 	inline Viewport* getViewport(int i) { return mViewports[i]; }
@@ -270,6 +285,10 @@ struct ShadowMgr : public CNode {
 	int mUnused0;                               // _44, seems to be entirely unused
 	Color4 mColor;                              // _48
 	ShadowParms* mParms;                        // _4C
+
+#if FOR_MODDING
+	ShadowNode* mShadowHash[SHADOW_HASH_SIZE]; // _50, normal shadow nodes by creature
+#endif
 };
 
 extern ShadowMgr* shadowMgr;
@@ -83,10 +83,18 @@ struct J3DAnmTransformKey : public J3DAnmTransform {
 	    : J3DAnmTransform()
 	    , _20(0)
 	    , mTable(nullptr)
+#if FOR_MODDING
+	    , mSampleCache(nullptr)
+	    , mSampleValid(nullptr)
+#endif
 	{
 	}
 
+#if FOR_MODDING
+	virtual ~J3DAnmTransformKey() { releaseSampleCache(); } // _08 (weak)
+#else
 	virtual ~J3DAnmTransformKey() { }  // _08 (weak)
+#endif
 	virtual J3DAnmKind getKind() const // _0C (weak)
 	{
 		return J3DAnmKind_TransformKey;
@@ -95,10 +103,27 @@ struct J3DAnmTransformKey : public J3DAnmTransform {
 
 	void calcTransform(f32, u16, J3DTransformInfo*) const;
 
+#if FOR_MODDING
+	bool createSampleCache();
+	void releaseSampleCache();
+	static void resetSampleCacheBudget();
+
+	static u32 sSampleCacheMaxSize; // per animation, 0 = no caching
+	static u32 sSampleCacheBudget;  // cap on sSampleCacheSize
+	static u32 sSampleCacheSize;    // bytes allocated by all caches so far
+	static u32 sSampleCacheHitNum;  // calcTransform calls answered from a cache
+	static u32 sSampleCacheMissNum; // calcTransform calls that filled a cache entry
+#endif
+
 	// _00     = VTBL
 	// _00-_20 = J3DAnmTransform
 	int _20;                         // _20
 	J3DAnmTransformKeyTable* mTable; // _24
+
+#if FOR_MODDING
+	J3DTransformInfo* mSampleCache; // _28, pose per joint at each whole frame, filled as it gets sampled
+	u32* mSampleValid;              // _2C, bit per mSampleCache entry
+#endif
 };
 
 struct J3DAnmTransformKeyData : public J3DAnmFullData {
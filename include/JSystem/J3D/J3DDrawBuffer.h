@@ -69,6 +69,11 @@ struct J3DDrawBuffer {
 	bool entryModelSort(J3DMatPacket*);
 	bool entryInvalidSort(J3DMatPacket*);
 	bool entryNonSort(J3DMatPacket*);
+#if FOR_MODDING
+	bool entryKeySort(J3DMatPacket*);
+	void setKeySort();
+	void countKeySortChanges();
+#endif
 	void draw() const;
 	void drawHead() const;
 	void drawTail() const;
@@ -83,6 +88,12 @@ struct J3DDrawBuffer {
 	static sortFunc sortFuncTable[6];
 	static drawFunc drawFuncTable[2];
 	static int entryNum;
+#if FOR_MODDING
+	// running totals for key-sorted buffers (see setKeySort), like entryNum
+	static int keySortMergeNum;     // packets drawn under an earlier packet's material
+	static int keySortTexChangeNum; // texture changes left in submission order
+	static int keySortVtxChangeNum; // vcd/vat changes left in submission order
+#endif
 
 	J3DPacket** mBuffer;        // _00
 	u32 mBufferSize;            // _04
@@ -93,6 +104,11 @@ struct J3DDrawBuffer {
 	f32 mRatioZ;                // _18
 	MtxP mMtxZ;                 // _1C
 	J3DPacket* mCallBackPacket; // _20
+
+#if FOR_MODDING
+	u32* mSortKeys;   // _24, parallel to mBuffer when key sorted, else null
+	u32 mKeyEntryNum; // _28
+#endif
 };
 
 #endif
@@ -23,7 +23,11 @@ struct J3DJointTree {
 	 * @reifiedAddress{80083874}
 	 * @reifiedFile{JSystem/J3D/J3DModelData.cpp}
 	 */
+#if FOR_MODDING
+	virtual ~J3DJointTree() { delete[] (u8*)mCalcOrder; }; // _0C (weak)
+#else
 	virtual ~J3DJointTree() {}; // _0C (weak)
+#endif
 
 	void findImportantMtxIndex();
 	void makeHierarchy(J3DJoint*, const J3DModelHierarchy**, J3DMaterialTable*, J3DShapeTable*);
@@ -31,6 +35,13 @@ struct J3DJointTree {
 	// unused/inlined:
 	void clear();
 
+#if FOR_MODDING
+	void makeCalcOrder();
+	void calcFlat();
+
+	static bool useFlatCalc;
+#endif
+
 	J3DJoint* getJointNodePointer(u32 idx) const { return mJoints[idx]; }
 	u32 getWEvlpMtxNum() const { return mEnvelopeCnt; }
 	u8 getWEvlpMixMtxNum(u16 idx) const { return mEnvelopeMixCnt[idx]; }
@@ -66,6 +77,12 @@ struct J3DJointTree {
 	J3DDrawMtxData mMtxData;       // _34
 	u32 _40;                       // _40
 	JUTNameTab* mNametab;          // _44
+
+#if FOR_MODDING
+	J3DJoint** mCalcOrder; // _48, joints in recursiveCalc order, null if the tree is too deep. owns mCalcDepth too
+	u8* mCalcDepth;        // _4C, depth of each mCalcOrder joint, root is 0
+	u16 mCalcOrderNum;     // _50
+#endif
 };
 
 #endif
@@ -11,6 +11,13 @@
 struct J3DMaterial;
 struct J3DTextureSRTInfo;
 
+#if FOR_MODDING
+// Distinct animations a material anm can track before it always recalculates.
+// Each anm kind (colour, tex pattern, tev reg, tex srt) normally binds one animation per material,
+// so this leaves room for two of each.
+#define J3DMATANM_SIGNATURE_MAX (8)
+#endif
+
 struct J3DMatColorAnm {
 	J3DMatColorAnm(J3DAnmColor* anm, u16 index, u16 flag)
 	{
@@ -168,12 +175,28 @@ struct J3DMaterialAnm {
 
 	const J3DTexMtxAnm& getTexMtxAnm(int i) const { return mTexMtxAnmList[i]; }
 
+#if FOR_MODDING
+	bool updateCalcSignature();
+
+	// Skip calc() when no bound animation has moved since the last call.
+	static bool useCalcSkip;
+	static u32 sCalcNum;
+	static u32 sCalcSkipNum;
+	static u32 sCalcUntrackedNum; // of sCalcNum, calls with too many animations to track
+#endif
+
 	// _00 = VTBL
 	J3DMatColorAnm mMatColAnmList[2];   // _04
 	J3DTexMtxAnm mTexMtxAnmList[8];     // _14
 	J3DTexNoAnm mTexNoAnmList[8];       // _54
 	J3DTevColorAnm mTevColAnmList[4];   // _B4
 	J3DTevKColorAnm mTevKColAnmList[4]; // _D4
+#if FOR_MODDING
+	const J3DAnmBase* mLastAnm[J3DMATANM_SIGNATURE_MAX]; // _F4
+	f32 mLastFrame[J3DMATANM_SIGNATURE_MAX];             // _114
+	bool mHasLastCalc;                                   // _134
+	u8 mLastAnmNum;                                      // _135
+#endif
 };
 
 #endif
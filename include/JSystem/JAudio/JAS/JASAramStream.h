@@ -60,6 +60,12 @@ struct JASAramStream {
 	void prepare(const char*, int);
 	u32 getBlockSamples() const;
 
+#if FOR_MODDING
+	u32 getPendingLoadNum() const { return mLoadedCount; }
+	u32 getPeakPendingLoadNum() const { return mPeakLoadedCount; }
+	u32 getUnderrunNum() const { return mUnderrunNum; }
+#endif
+
 	OSMessageQueue mMsgQueueA;       // _00
 	OSMessageQueue mMsgQueueB;       // _20
 	void* mMsgSlotsA[16];            // _40
@@ -106,6 +112,10 @@ struct JASAramStream {
 	f32 mChannelData[4][6];          // _26C, values (volume, pan, fxmix, dolby) for each of the 6 channels
 	u16 mMixData[6];                 // _2CC
 	u8 mUseStereo;                   // _2D8, related to pan
+#if FOR_MODDING
+	u32 mPeakLoadedCount; // _2DC, most block loads queued at once
+	u32 mUnderrunNum;     // _2E0, times playback was held for queued loads
+#endif
 
 	static JASTaskThread* sLoadThread;
 	static u8* sReadBuffer;
@@ -113,6 +123,13 @@ struct JASAramStream {
 	static u32 sChannelMax;
 	static bool sSystemPauseFlag;
 	static bool sFatalErrorFlag;
+
+#if FOR_MODDING
+	// Block loads read at the highest DVD priority once this many are queued for one stream.
+	static u32 sUrgentLoadNum;
+	static u32 sUrgentReadNum;
+	static u32 sUnderrunTotalNum;
+#endif
 };
 
 #endif
@@ -99,6 +99,13 @@ struct JASChannel : public JSULink<JASChannel>,
 
 	static const u8 calc_sw_table[27][3];
 
+#if FOR_MODDING
+	// Reuse the previous mixer volumes when updateMixer's inputs have not changed.
+	static bool useMixerCache;
+	static u32 sMixerCacheHitNum;
+	static u32 sMixerCacheMissNum;
+#endif
+
 	// vtable 1: _10
 	// vtable 2: _14
 	int mStatus;                   // _18
@@ -132,6 +139,12 @@ struct JASChannel : public JSULink<JASChannel>,
 	u8 mFxMixCalcType;             // _109
 	u8 mDolbyCalcType;             // _10A
 	PanVector mPanPower;           // _10C
+#if FOR_MODDING
+	f32 mMixerCacheInput[4];  // _118, volume, pan, fxmix, dolby
+	u16 mMixerCacheLevel;     // _128
+	u16 mMixerCacheVolume[6]; // _12A
+	bool mMixerCacheValid;    // _136
+#endif
 };
 
 /**
@@ -20,9 +20,18 @@ struct JASGenericMemPool {
 	// unused/inlined:
 	~JASGenericMemPool();
 
+#if FOR_MODDING
+	int getMinFreeMemCount() const { return mMinFreeMemCount; }
+	u32 getAllocFailNum() const { return mAllocFailNum; }
+#endif
+
 	void** mNextFreeBlock;  // _00
 	void** mFirstFreeBlock; // _04
 	int mFreeMemCount;      // _08
+#if FOR_MODDING
+	int mMinFreeMemCount; // _0C, low-water mark of mFreeMemCount, -1 until newMemPool
+	u32 mAllocFailNum;    // _10
+#endif
 };
 
 namespace JASCreationPolicy {
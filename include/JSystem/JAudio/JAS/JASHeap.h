@@ -38,6 +38,9 @@ struct JASHeap {
 	u8* mBase;              // _38
 	u32 mSize;              // _3C
 	JASHeap* mLastChild;    // _40
+#if FOR_MODDING
+	u32 mChildSize; // _44, bytes held by direct children
+#endif
 };
 
 struct JASSolidHeap : public JASHeap {
@@ -286,6 +286,9 @@ struct JASTrack : public JSUList<JASChannel> {
 	void setTempo(u16);
 	void setTimebase(u16);
 	f32 panCalc(f32 valA, f32 valB, f32 weight, u8 calcType);
+#if FOR_MODDING
+	f32 calcPitchCent();
+#endif
 	void setNoteMask(u8);
 	void muteTrack(bool);
 
@@ -338,6 +341,13 @@ struct JASTrack : public JSUList<JASChannel> {
 
 	static SeqCallback sCallBackFunc;
 
+#if FOR_MODDING
+	// Reuse the last pitch-to-cent conversion while the track's pitch and bend range hold.
+	static bool usePitchCentCache;
+	static u32 sPitchCentCacheHitNum;
+	static u32 sPitchCentCacheMissNum;
+#endif
+
 	// _00-_0C = JSUList
 	JASSeqCtrl mSeqCtrl;               // _0C
 	JASTrackPort mTrackPort;           // _54
@@ -384,6 +394,12 @@ struct JASTrack : public JSUList<JASChannel> {
 	u8 mTimeRelate;                    // _364
 	u8 _365;                           // _365
 	u8 _366;                           // _366
+#if FOR_MODDING
+	bool mPitchCentCacheValid;         // _367
+	f32 mPitchCentCacheInput;          // _368
+	f32 mPitchCentCacheRange;          // _36C
+	f32 mPitchCentCacheOutput;         // _370
+#endif
 };
 
 #endif
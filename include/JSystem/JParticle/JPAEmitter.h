@@ -448,6 +448,17 @@ struct JPAEmitterManager {
 
 	JPAResourceManager* getResourceManager(u16 idx) { return mResMgrAry[idx]; }
 
+#if FOR_MODDING
+	// return false to run only JPAResource::calcIdle (clock, termination, callbacks) for an emitter this call
+	typedef bool (*CalcFilter)(JPABaseEmitter*, void*);
+
+	void setCalcFilter(CalcFilter filter, void* arg)
+	{
+		mCalcFilter    = filter;
+		mCalcFilterArg = arg;
+	}
+#endif
+
 	JSUList<JPABaseEmitter>* mGrpEmtr;     // _00
 	JSUList<JPABaseEmitter> mFreeEmtrList; // _04
 	JPAList<JPABaseParticle> mPtclPool;    // _10
@@ -457,6 +468,10 @@ struct JPAEmitterManager {
 	uint mPtclMax;                         // _28
 	u8 mGrpMax;                            // _2C
 	u8 mResMax;                            // _2D
+#if FOR_MODDING
+	CalcFilter mCalcFilter; // _30
+	void* mCalcFilterArg;   // _34
+#endif
 };
 
 #endif
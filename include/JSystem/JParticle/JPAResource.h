@@ -36,6 +36,10 @@ struct JPAResource {
 	void calcWorkData_c(JPAEmitterWorkData*);
 	void calcWorkData_d(JPAEmitterWorkData*);
 
+#if FOR_MODDING
+	bool calcIdle(JPAEmitterWorkData*, struct JPABaseEmitter*);
+#endif
+
 	JPABaseShape* getBsp() const { return mBaseShape; }
 	JPAExtraShape* getEsp() const { return mExtraShape; }
 	JPAChildShape* getCsp() const { return mChildShape; }
@@ -71,6 +75,10 @@ struct JPAResource {
 	u8 mDrawParticleFuncListNum;               // _45
 	u8 mCalcParticleChildFuncListNum;          // _46
 	u8 mDrawParticleChildFuncListNum;          // _47
+
+#if FOR_MODDING
+	bool mHasUniformFields; // _48, every field is a constant push without fade, see calcField
+#endif
 };
 
 /**
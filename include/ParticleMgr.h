@@ -63,6 +63,11 @@ struct ParticleMgr : public CNode {
 	ModelEffectData* getModelEffectData(u64);
 	void testCreateModelEffect(int, int, Vector3f&);
 
+#if FOR_MODDING
+	void calcEmitters();
+	bool isEmitterCulled(JPABaseEmitter*);
+#endif
+
 	inline JPAEmitterManager* getManager() const { return mEmitterManager; }
 	inline Game::GameLightMgr* getLightMgr() const { return mLightMgr; }
 
@@ -79,10 +84,19 @@ struct ParticleMgr : public CNode {
 	JKRHeap* mModelEffectHeap;                  // _A4
 	int mUnusedVal;                             // _A8
 
+#if FOR_MODDING
+	u32 mCalcFrame;           // _AC
+	int mCulledEmitterNum;    // _B0, idle emitters found off-screen last update
+	int mThrottledEmitterNum; // _B4, of those, how many only got calcIdle
+#endif
+
 	static bool disableCulling;
 	static f32 mClipRadiusS; // = 10.0f;
 	static f32 mClipRadiusM; // = 30.0f;
 	static f32 mClipRadiusL; // = 100.0f;
+#if FOR_MODDING
+	static u8 mCulledCalcInterval;
+#endif
 };
 
 extern ParticleMgr* particleMgr;
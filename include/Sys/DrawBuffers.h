@@ -15,6 +15,9 @@ namespace Sys {
 struct DrawBuffer : public CNode {
 	enum DrawBufferFlags {
 		DRAWBUFF_Unk1 = 0x1,
+#if FOR_MODDING
+		DRAWBUFF_KeySort = 0x2, // opaque J3DSORT_Mat buffers only, see J3DDrawBuffer::setKeySort
+#endif
 	};
 
 	struct CreateArg {
@@ -32,12 +32,23 @@ struct GridDivider : public TriDivider {
 		mTriIndexLists = nullptr;
 		mMaxZ          = 0;
 		mMaxX          = 0;
+#if FOR_MODDING
+		mLastTriList   = nullptr;
+		mTopTriOffsets = nullptr;
+		mTopTriIndices = nullptr;
+		mTopTriY       = nullptr;
+#endif
 	}
 
 	virtual ~GridDivider() // _08 (weak)
 	{
 		if (&mMaxX)
 			delete[] mTriIndexLists;
+#if FOR_MODDING
+		delete[] mTopTriOffsets;
+		delete[] mTopTriIndices;
+		delete[] mTopTriY;
+#endif
 	}
 	virtual f32 getMinY(Vector3f&);                                       // _10
 	virtual TriIndexList* findTriLists(Sphere&);                          // _14
@@ -49,6 +60,11 @@ struct GridDivider : public TriDivider {
 
 	void create(BoundBox&, int, int, VertexTable*, TriangleTable*);
 
+#if FOR_MODDING
+	void createTopTriLists();
+	f32 getTopY(Vector3f&);
+#endif
+
 	// Unused/inlined:
 	void write(Stream&);
 
@@ -65,6 +81,19 @@ struct GridDivider : public TriDivider {
 	BoundBox mBoundingBox;        // _2C
 	f32 mScaleX;                  // _44
 	f32 mScaleZ;                  // _48
+#if FOR_MODDING
+	// cell range and chain built by the previous findTriLists call, reused while the range doesn't change
+	int mLastMinX;
+	int mLastMinZ;
+	int mLastMaxX;
+	int mLastMaxZ;
+	TriIndexList* mLastTriList;
+
+	// per cell copy of the upward facing triangles, highest vertex first, for getTopY
+	int* mTopTriOffsets; // cell i uses entries [mTopTriOffsets[i], mTopTriOffsets[i + 1])
+	int* mTopTriIndices;
+	f32* mTopTriY; // highest vertex y of each entry
+#endif
 };
 } // namespace Sys
 
@@ -196,6 +196,21 @@ void J3DAnmTransformFull::getTransform(u16 idx, J3DTransformInfo* info) const
  */
 void J3DAnmTransformKey::calcTransform(f32 p1, u16 p2, J3DTransformInfo* info) const
 {
+#if FOR_MODDING
+	u32 sample = 0xFFFFFFFF;
+	if (mSampleCache && p1 >= 0.0f && p1 < mTotalFrameCount && p2 < mUpdateMaterialNum) {
+		int frame = (int)p1;
+		if (frame == p1) {
+			sample = frame * mUpdateMaterialNum + p2;
+			if (mSampleValid[sample >> 5] & (1 << (sample & 31))) {
+				*info = mSampleCache[sample];
+				sSampleCacheHitNum++;
+				return;
+			}
+		}
+	}
+#endif
+
 	u16 idx                       = p2 * 3;
 	J3DAnmTransformKeyTable* xInf = &mTable[idx];
 	J3DAnmTransformKeyTable* yInf = &mTable[idx + 1];
@@ -308,7 +323,87 @@ void J3DAnmTransformKey::calcTransform(f32 p1, u16 p2, J3DTransformInfo* info) c
 		info->mTranslation.z
 		    = J3DGetKeyFrameInterpolation<f32>(p1, &zInf->mTranslationInfo, &mTranslationVals[zInf->mTranslationInfo.mOffset]);
 	}
+
+#if FOR_MODDING
+	if (sample != 0xFFFFFFFF) {
+		mSampleCache[sample] = *info;
+		mSampleValid[sample >> 5] |= (1 << (sample & 31));
+		sSampleCacheMissNum++;
+	}
+#endif
+}
+
+#if FOR_MODDING
+u32 J3DAnmTransformKey::sSampleCacheMaxSize;
+u32 J3DAnmTransformKey::sSampleCacheBudget;
+u32 J3DAnmTransformKey::sSampleCacheSize;
+u32 J3DAnmTransformKey::sSampleCacheHitNum;
+u32 J3DAnmTransformKey::sSampleCacheMissNum;
+
+/**
+ * Allocates a pose cache for whole-frame samples on the current heap, if it fits in sSampleCacheMaxSize
+ * and the remaining sSampleCacheBudget. Models playing the same animation at the same frame then share
+ * the keyframe work. Off unless a loader raises both limits (see NaviMgr::load).
+ */
+bool J3DAnmTransformKey::createSampleCache()
+{
+	if (mSampleCache || mTotalFrameCount <= 0 || mUpdateMaterialNum == 0) {
+		return false;
+	}
+
+	u32 count     = mTotalFrameCount * mUpdateMaterialNum;
+	u32 validSize = (count + 31) >> 5;
+	u32 size      = count * sizeof(J3DTransformInfo) + validSize * sizeof(u32);
+	if (size > sSampleCacheMaxSize || sSampleCacheSize + size > sSampleCacheBudget) {
+		return false;
+	}
+
+	// poses and valid bits share one block, so a failed allocation leaves nothing behind
+	u8* block = new u8[size];
+	if (!block) {
+		return false;
+	}
+
+	mSampleCache = (J3DTransformInfo*)block;
+	mSampleValid = (u32*)(block + count * sizeof(J3DTransformInfo));
+
+	for (u32 i = 0; i < validSize; i++) {
+		mSampleValid[i] = 0;
+	}
+	sSampleCacheSize += size;
+	return true;
+}
+
+/**
+ * Frees the pose cache and gives its bytes back to sSampleCacheBudget.
+ */
+void J3DAnmTransformKey::releaseSampleCache()
+{
+	if (!mSampleCache) {
+		return;
+	}
+
+	u32 count = mTotalFrameCount * mUpdateMaterialNum;
+	u32 size  = count * sizeof(J3DTransformInfo) + ((count + 31) >> 5) * sizeof(u32);
+	delete[] (u8*)mSampleCache;
+	mSampleCache = nullptr;
+	mSampleValid = nullptr;
+
+	// the budget may already have been reset by the owner of the heap the cache lived on
+	sSampleCacheSize -= (size < sSampleCacheSize) ? size : sSampleCacheSize;
+}
+
+/**
+ * Called when the heap holding the caches is torn down without running the animations' destructors,
+ * so the next load starts with the whole budget. Also clears the hit/miss counters.
+ */
+void J3DAnmTransformKey::resetSampleCacheBudget()
+{
+	sSampleCacheSize    = 0;
+	sSampleCacheHitNum  = 0;
+	sSampleCacheMissNum = 0;
 }
+#endif
 
 /**
  * @note Address: 0x8006829C
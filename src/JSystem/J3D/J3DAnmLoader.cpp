@@ -461,6 +461,9 @@ void J3DAnmKeyLoader_v15::setAnmTransform(J3DAnmTransformKey* animation, const J
 	animation->mScaleVals       = JSUConvertOffsetToPtr<f32>(data, (void*)data->mScaleOffset);
 	animation->mRotationVals    = JSUConvertOffsetToPtr<s16>(data, (void*)data->mRotationOffset);
 	animation->mTranslationVals = JSUConvertOffsetToPtr<f32>(data, (void*)data->mTranslateOffset);
+#if FOR_MODDING
+	animation->createSampleCache();
+#endif
 }
 
 /**
@@ -20,6 +20,12 @@ void J3DDrawBuffer::calcZRatio() { mRatioZ = (mFarZ - mNearZ) / (f32)mBufferSize
 
 int J3DDrawBuffer::entryNum;
 
+#if FOR_MODDING
+int J3DDrawBuffer::keySortMergeNum;
+int J3DDrawBuffer::keySortTexChangeNum;
+int J3DDrawBuffer::keySortVtxChangeNum;
+#endif
+
 /**
  * @note Address: 0x800659A4
  * @note Size: 0x68
@@ -34,6 +40,10 @@ void J3DDrawBuffer::initialize()
 	mCallBackPacket = nullptr;
 	mBufferSize     = 0x20;
 	calcZRatio();
+#if FOR_MODDING
+	mSortKeys    = nullptr;
+	mKeyEntryNum = 0;
+#endif
 }
 
 /**
@@ -56,12 +66,20 @@ J3DErrType J3DDrawBuffer::allocBuffer(u32 size)
  */
 void J3DDrawBuffer::frameInit()
 {
+#if FOR_MODDING
+	if (mSortKeys) {
+		countKeySortChanges();
+	}
+#endif
 	u32 bufSize = mBufferSize;
 	for (u32 i = 0; i < bufSize; i++) {
 		mBuffer[i] = nullptr;
 	}
 
 	mCallBackPacket = nullptr;
+#if FOR_MODDING
+	mKeyEntryNum = 0;
+#endif
 }
 
 /**
@@ -70,6 +88,11 @@ void J3DDrawBuffer::frameInit()
  */
 bool J3DDrawBuffer::entryMatSort(J3DMatPacket* materialPacket)
 {
+#if FOR_MODDING
+	if (mSortKeys) {
+		return entryKeySort(materialPacket);
+	}
+#endif
 	materialPacket->drawClear();
 	materialPacket->getShapePacket()->drawClear();
 
@@ -223,6 +246,106 @@ bool J3DDrawBuffer::entryNonSort(J3DMatPacket* materialPacket)
 	return true;
 }
 
+#if FOR_MODDING
+/**
+ * Makes a J3DSORT_Mat buffer keep its packets in one flat list ordered by key instead of texture hash buckets.
+ * The key ignores Z, so this is only for opaque buffers; translucent ones need their submission or Z order.
+ */
+void J3DDrawBuffer::setKeySort()
+{
+	if (mSortType != J3DSORT_Mat) {
+		return;
+	}
+
+	if (mSortKeys == nullptr) {
+		mSortKeys = new (0x20) u32[mBufferSize];
+	}
+	mKeyEntryNum = 0;
+}
+
+/**
+ * Inserts the packet into the list in key order. The key is, high to low: not changed, texture address,
+ * material diff flags and vcd/vat command address, so changed packets come first like in entryMatSort.
+ * A packet with the same key as an earlier one is merged into it if the materials match.
+ * Once the list is full the rest are chained onto the last entry unsorted.
+ */
+bool J3DDrawBuffer::entryKeySort(J3DMatPacket* materialPacket)
+{
+	materialPacket->drawClear();
+	materialPacket->getShapePacket()->drawClear();
+
+	if (mKeyEntryNum >= mBufferSize) {
+		J3DPacket* last = mBuffer[mBufferSize - 1];
+		materialPacket->setNextPacket(last->getNextPacket());
+		last->setNextPacket(materialPacket);
+		return true;
+	}
+
+	u32 key = 0;
+	if (!materialPacket->isChanged()) {
+		J3DTexture* texture = j3dSys.getTexture();
+		u16 texNo           = materialPacket->getMaterial()->getTexNo(0);
+		u32 texHash         = 0;
+		if (texNo != 0xFFFF) {
+			texHash = ((u32)texture->getResTIMG(texNo) + texture->getResTIMG(texNo)->mImageDataOffset) >> 5;
+		}
+
+		u32 diff    = materialPacket->mDiffFlag;
+		u32 matHash = (diff ^ (diff >> 8) ^ (diff >> 16) ^ (diff >> 24)) & 0xFF;
+		u32 vtxHash = ((u32)materialPacket->getShapePacket()->getShape()->getVcdVatCmd() >> 5) & 0xFF;
+		key         = 0x80000000 | ((texHash & 0x7FFF) << 16) | (matHash << 8) | vtxHash;
+	}
+
+	// insert after any equal keys, so equal packets keep their submission order
+	u32 pos = mKeyEntryNum;
+	while (pos > 0 && mSortKeys[pos - 1] > key) {
+		pos--;
+	}
+
+	if (key != 0) {
+		for (u32 i = pos; i > 0 && mSortKeys[i - 1] == key; i--) {
+			J3DMatPacket* pkt = (J3DMatPacket*)mBuffer[i - 1];
+			if (pkt->isSame(materialPacket)) {
+				pkt->addShapePacket(materialPacket->getShapePacket());
+				keySortMergeNum++;
+				return false;
+			}
+		}
+	}
+
+	for (u32 i = mKeyEntryNum; i > pos; i--) {
+		mSortKeys[i] = mSortKeys[i - 1];
+		mBuffer[i]   = mBuffer[i - 1];
+	}
+	mBuffer[pos]   = materialPacket;
+	mSortKeys[pos] = key;
+	mKeyEntryNum++;
+	return true;
+}
+
+/**
+ * Adds the texture and vcd/vat changes the last frame's sorted list still made to the running totals.
+ */
+void J3DDrawBuffer::countKeySortChanges()
+{
+	void* lastTex = nullptr;
+	void* lastVtx = nullptr;
+	for (u32 i = 0; i < mKeyEntryNum; i++) {
+		J3DMatPacket* packet = (J3DMatPacket*)mBuffer[i];
+		void* tex            = (void*)(mSortKeys[i] & 0xFFFF0000);
+		void* vtx            = packet->getShapePacket()->getShape()->getVcdVatCmd();
+		if (i == 0 || tex != lastTex) {
+			keySortTexChangeNum++;
+		}
+		if (i == 0 || vtx != lastVtx) {
+			keySortVtxChangeNum++;
+		}
+		lastTex = tex;
+		lastVtx = vtx;
+	}
+}
+#endif
+
 /**
  * @note Address: 0x800660BC
  * @note Size: 0x54
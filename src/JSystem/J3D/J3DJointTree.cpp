@@ -24,6 +24,11 @@ J3DJointTree::J3DJointTree()
     , mMtxData()
     , _40(0)
     , mNametab(nullptr)
+#if FOR_MODDING
+    , mCalcOrder(nullptr)
+    , mCalcDepth(nullptr)
+    , mCalcOrderNum(0)
+#endif
 {
 }
 
@@ -148,6 +153,133 @@ void J3DJointTree::calc(J3DMtxBuffer* buffer, const Vec& vec, const Mtx& mtx)
 	J3DJoint* root = mRootNode;
 	if (root) {
 		J3DJoint::mCurrentMtxCalc = mTransformCalc;
+#if FOR_MODDING
+		if (useFlatCalc && mCalcOrder) {
+			calcFlat();
+			return;
+		}
+#endif
 		root->recursiveCalc();
 	}
 }
+
+#if FOR_MODDING
+#define J3D_FLAT_CALC_DEPTH_MAX (32)
+
+bool J3DJointTree::useFlatCalc = true;
+
+/**
+ * State recursiveCalc keeps on the stack for a joint until its children are done.
+ */
+struct J3DFlatCalcFrame {
+	J3DJoint* mJoint;           // _00
+	J3DMtxCalc* mPrevMtxCalc;   // _04
+	J3DJointCallBack mCallBack; // _08
+	Mtx mCurrentMtx;            // _0C
+	Vec mCurrentS;              // _3C
+	Vec mParentS;               // _48
+};
+
+/**
+ * Adds joint, its subtree and its younger siblings in the order recursiveCalc visits them.
+ */
+static void addCalcOrder(J3DJointTree* tree, J3DJoint* joint, int depth, bool& tooDeep)
+{
+	for (; joint; joint = joint->getYounger()) {
+		if (depth >= J3D_FLAT_CALC_DEPTH_MAX || tree->mCalcOrderNum >= tree->mJointCnt) {
+			tooDeep = true;
+			return;
+		}
+
+		tree->mCalcOrder[tree->mCalcOrderNum] = joint;
+		tree->mCalcDepth[tree->mCalcOrderNum] = depth;
+		tree->mCalcOrderNum++;
+		addCalcOrder(tree, joint->getChild(), depth + 1, tooDeep);
+	}
+}
+
+/**
+ * Flattens the joint hierarchy for calcFlat. Call once the hierarchy has been made.
+ */
+void J3DJointTree::makeCalcOrder()
+{
+	if (mCalcOrder || !mRootNode || mJointCnt == 0) {
+		return;
+	}
+
+	// one block for both arrays, freed with the tree
+	u8* block = new u8[mJointCnt * (sizeof(J3DJoint*) + sizeof(u8))];
+	if (!block) {
+		return;
+	}
+
+	mCalcOrder    = (J3DJoint**)block;
+	mCalcDepth    = block + mJointCnt * sizeof(J3DJoint*);
+	mCalcOrderNum = 0;
+
+	bool tooDeep = false;
+	addCalcOrder(this, mRootNode, 0, tooDeep);
+	if (tooDeep) {
+		delete[] block;
+		mCalcOrder    = nullptr;
+		mCalcDepth    = nullptr;
+		mCalcOrderNum = 0;
+	}
+}
+
+/**
+ * Same as mRootNode->recursiveCalc(), as a loop over mCalcOrder with an explicit stack.
+ * Before a joint is calculated, every stacked joint at its depth or deeper is finished off
+ * (state restored, then the callback with 1), just like returning from recursiveCalc.
+ * The stack is local, so a joint callback may calc another model from inside.
+ */
+void J3DJointTree::calcFlat()
+{
+	J3DFlatCalcFrame stack[J3D_FLAT_CALC_DEPTH_MAX];
+	int top = -1;
+	for (u16 i = 0; i <= mCalcOrderNum; i++) {
+		int depth = (i < mCalcOrderNum) ? mCalcDepth[i] : 0;
+		for (; top >= depth; top--) {
+			J3DFlatCalcFrame& frame = stack[top];
+			PSMTXCopy(frame.mCurrentMtx, J3DSys::mCurrentMtx);
+			J3DSys::mCurrentS = frame.mCurrentS;
+			J3DSys::mParentS  = frame.mParentS;
+
+			if (frame.mPrevMtxCalc != nullptr) {
+				J3DJoint::mCurrentMtxCalc = frame.mPrevMtxCalc;
+			}
+			if (frame.mCallBack != nullptr) {
+				(*frame.mCallBack)(frame.mJoint, 1);
+			}
+		}
+
+		if (i == mCalcOrderNum) {
+			break;
+		}
+
+		J3DJoint* joint         = mCalcOrder[i];
+		J3DFlatCalcFrame& frame = stack[++top];
+		frame.mJoint            = joint;
+		frame.mPrevMtxCalc      = nullptr;
+		PSMTXCopy(J3DSys::mCurrentMtx, frame.mCurrentMtx);
+		frame.mCurrentS = J3DSys::mCurrentS;
+		frame.mParentS  = J3DSys::mParentS;
+
+		J3DMtxCalc* mtxCalc = joint->getMtxCalc();
+		if (mtxCalc != nullptr) {
+			frame.mPrevMtxCalc        = J3DJoint::mCurrentMtxCalc;
+			J3DJoint::mCurrentMtxCalc = mtxCalc;
+			J3DMtxCalc::setJoint(joint);
+			mtxCalc->calc();
+		} else if (J3DJoint::mCurrentMtxCalc != nullptr) {
+			J3DMtxCalc::setJoint(joint);
+			J3DJoint::mCurrentMtxCalc->calc();
+		}
+
+		frame.mCallBack = joint->getCallBack();
+		if (frame.mCallBack != nullptr) {
+			(*frame.mCallBack)(joint, 0);
+		}
+	}
+}
+#endif
@@ -31,6 +31,10 @@ void J3DMaterialAnm::initialize()
 	for (int i = 0; i < 8; i++) {
 		mTexMtxAnmList[i].setAnmFlag(false);
 	}
+#if FOR_MODDING
+	mHasLastCalc = false;
+	mLastAnmNum  = 0;
+#endif
 }
 
 /**
@@ -73,3 +77,93 @@ void J3DMaterialAnm::calc(J3DMaterial* material) const
 		}
 	}
 }
+
+#if FOR_MODDING
+bool J3DMaterialAnm::useCalcSkip      = true;
+u32 J3DMaterialAnm::sCalcNum          = 0;
+u32 J3DMaterialAnm::sCalcSkipNum      = 0;
+u32 J3DMaterialAnm::sCalcUntrackedNum = 0;
+
+/**
+ * Adds an animation to a signature unless it is already in it.
+ * Returns false once more than J3DMATANM_SIGNATURE_MAX distinct animations are bound.
+ */
+static bool addSignatureAnm(const J3DAnmBase* anm, const J3DAnmBase** anms, f32* frames, u8& num)
+{
+	for (u8 i = 0; i < num; i++) {
+		if (anms[i] == anm) {
+			return true;
+		}
+	}
+
+	if (num >= J3DMATANM_SIGNATURE_MAX) {
+		return false;
+	}
+
+	anms[num]   = anm;
+	frames[num] = anm->getFrame();
+	num++;
+	return true;
+}
+
+/**
+ * Records the animations bound to this material anm and their current frames.
+ * Returns true if calc() needs to run, i.e. an animation was rebound or has moved
+ * (a paused frame control leaves its frame untouched) since the previous call.
+ */
+bool J3DMaterialAnm::updateCalcSignature()
+{
+	const J3DAnmBase* anms[J3DMATANM_SIGNATURE_MAX];
+	f32 frames[J3DMATANM_SIGNATURE_MAX];
+	u8 num     = 0;
+	bool valid = true;
+
+	for (u32 i = 0; valid && i < ARRAY_SIZE(mMatColAnmList); i++) {
+		if (mMatColAnmList[i].getAnmFlag()) {
+			valid = addSignatureAnm(mMatColAnmList[i].mAnm, anms, frames, num);
+		}
+	}
+	for (u32 i = 0; valid && i < ARRAY_SIZE(mTexNoAnmList); i++) {
+		if (mTexNoAnmList[i].getAnmFlag()) {
+			valid = addSignatureAnm(mTexNoAnmList[i].getAnmTexPattern(), anms, frames, num);
+		}
+	}
+	for (u32 i = 0; valid && i < 3; i++) { // matches calc()
+		if (mTevColAnmList[i].getAnmFlag()) {
+			valid = addSignatureAnm(mTevColAnmList[i].mAnm, anms, frames, num);
+		}
+	}
+	for (u32 i = 0; valid && i < ARRAY_SIZE(mTevKColAnmList); i++) {
+		if (mTevKColAnmList[i].getAnmFlag()) {
+			valid = addSignatureAnm(mTevKColAnmList[i].mAnm, anms, frames, num);
+		}
+	}
+	for (u32 i = 0; valid && i < ARRAY_SIZE(mTexMtxAnmList); i++) {
+		if (mTexMtxAnmList[i].getAnmFlag()) {
+			valid = addSignatureAnm(mTexMtxAnmList[i].mAnm, anms, frames, num);
+		}
+	}
+
+	if (!valid) {
+		mHasLastCalc = false;
+		sCalcUntrackedNum++;
+		return true;
+	}
+
+	bool changed = !mHasLastCalc || num != mLastAnmNum;
+	for (u8 i = 0; !changed && i < num; i++) {
+		changed = (anms[i] != mLastAnm[i] || frames[i] != mLastFrame[i]);
+	}
+
+	if (changed) {
+		for (u8 i = 0; i < num; i++) {
+			mLastAnm[i]   = anms[i];
+			mLastFrame[i] = frames[i];
+		}
+		mLastAnmNum  = num;
+		mHasLastCalc = true;
+	}
+
+	return changed;
+}
+#endif
@@ -372,7 +372,18 @@ void J3DModel::calcMaterial()
 
 		J3DMaterial* material = getModelData()->getMaterialNodePointer(i);
 		if (material->getMaterialAnm() != nullptr) {
+#if FOR_MODDING
+			// material->calc below still runs, since texture matrices follow the joints
+			J3DMaterialAnm* anm = material->getMaterialAnm();
+			if (J3DMaterialAnm::useCalcSkip && !anm->updateCalcSignature()) {
+				J3DMaterialAnm::sCalcSkipNum++;
+			} else {
+				J3DMaterialAnm::sCalcNum++;
+				anm->calc(material);
+			}
+#else
 			material->getMaterialAnm()->calc(material);
+#endif
 		}
 
 		material->calc(getAnmMtx(material->getJoint()->getJntNo()));
@@ -97,6 +97,9 @@ J3DModelData* J3DModelLoader::load(const void* stream, u32 flags)
 	mModelData->init(mModelData->mJointTree.mHierarchy);
 	mModelData->mShapeTable.sortVcdVatCmd();
 	mModelData->mJointTree.findImportantMtxIndex();
+#if FOR_MODDING
+	mModelData->mJointTree.makeCalcOrder();
+#endif
 	setupBBoardInfo();
 	if (mModelData->mModelLoaderFlags & J3DMLF_NoMatrixTransform) {
 		for (u16 i = 0; i < mModelData->getShapeNum(); i++) {
@@ -199,6 +202,9 @@ J3DModelData* J3DModelLoader::loadBinaryDisplayList(const void* stream, u32 flag
 	mModelData->init(mModelData->mJointTree.mHierarchy);
 	mModelData->mShapeTable.sortVcdVatCmd();
 	mModelData->mJointTree.findImportantMtxIndex();
+#if FOR_MODDING
+	mModelData->mJointTree.makeCalcOrder();
+#endif
 	setupBBoardInfo();
 	mModelData->indexToPtr();
 	return mModelData;
@@ -110,6 +110,43 @@ void processGFrameSe()
 	checkPlayingSe();
 }
 
+#if FOR_MODDING
+/**
+ * Counts, for each ranked candidate, how many of the category's play slots hold it.
+ * checkNextFrameSe uses this in place of rescanning every slot per candidate.
+ */
+static void countHelperSlots(const SeHelper* helpers, u8* slotNum, JAISound** slots, u8 max)
+{
+	for (u8 k = 0; k < max; k++) {
+		slotNum[k] = 0;
+		if (!helpers[k].mSound) {
+			continue;
+		}
+
+		for (u8 m = 0; m < max; m++) {
+			if (slots[m] == helpers[k].mSound) {
+				slotNum[k]++;
+			}
+		}
+	}
+}
+
+/**
+ * Keeps countHelperSlots' result current when a play slot changes from one sound to another.
+ */
+static void moveHelperSlot(const SeHelper* helpers, u8* slotNum, u8 max, JAISound* from, JAISound* to)
+{
+	for (u8 k = 0; k < max; k++) {
+		if (from && helpers[k].mSound == from) {
+			slotNum[k]--;
+		}
+		if (to && helpers[k].mSound == to) {
+			slotNum[k]++;
+		}
+	}
+}
+#endif
+
 /**
  * @note Address: 0x800AE600
  * @note Size: 0x7E4
@@ -246,6 +283,10 @@ void checkNextFrameSe()
 		}
 
 		u8 max = categoryInfoTable[seScene][i * 2];
+#if FOR_MODDING
+		u8 helperSlotNum[16];
+		countHelperSlots(helpers, helperSlotNum, sePlaySound[i], max);
+#endif
 		for (u8 j = 0; j < max; j++) {
 			bool check       = false;
 			JAISe* playSound = static_cast<JAISe*>(sePlaySound[i][j]);
@@ -254,12 +295,19 @@ void checkNextFrameSe()
 			} else if (playSound->mState == SOUNDSTATE_Playing) {
 				if (playSound->mSoundID & 0xC00) {
 					releaseSeRegist(playSound);
+#if FOR_MODDING
+					// releaseSeRegist clears slots itself
+					countHelperSlots(helpers, helperSlotNum, sePlaySound[i], max);
+#endif
 				} else {
 					playSound->mState = SOUNDSTATE_Stored;
 					playSound->_14    = 255;
 				}
 				check = true;
 			} else if (playSound->mState == SOUNDSTATE_Inactive || playSound->mState == SOUNDSTATE_Fadeout) {
+#if FOR_MODDING
+				moveHelperSlot(helpers, helperSlotNum, max, sePlaySound[i][j], nullptr);
+#endif
 				sePlaySound[i][j] = nullptr;
 				check             = true;
 			} else {
@@ -286,6 +334,23 @@ void checkNextFrameSe()
 					continue;
 				}
 
+#if FOR_MODDING
+				if (helperSlotNum[k] != 0) {
+					check = false;
+				}
+#if DEBUG
+				// debug builds still rescan the slots and check the count agrees
+				bool isInSlot = false;
+				for (u8 m = 0; m < max; m++) {
+					if (sePlaySound[i][m] && helpers[k].mSound == sePlaySound[i][m]) {
+						isInSlot = true;
+					}
+				}
+				if (isInSlot != (helperSlotNum[k] != 0)) {
+					OSReport("checkNextFrameSe: category %d candidate %d slot count %d\n", i, k, helperSlotNum[k]);
+				}
+#endif
+#else
 				for (u8 m = 0; m < max; m++) { // THIS IS TOO MANY LOOPS JFC
 					JAISe* playSe = static_cast<JAISe*>(sePlaySound[i][m]);
 					if (playSe && helpers[k].mSound == playSe) {
@@ -293,15 +358,22 @@ void checkNextFrameSe()
 						m     = max;
 					}
 				}
+#endif
 
 				if (check == true) {
 					helpers[k].mSound = nullptr;
+#if FOR_MODDING
+					moveHelperSlot(helpers, helperSlotNum, max, sePlaySound[i][j], se);
+#endif
 					sePlaySound[i][j] = se;
 					k                 = max + 1;
 				}
 			}
 
 			if (k == max) {
+#if FOR_MODDING
+				moveHelperSlot(helpers, helperSlotNum, max, sePlaySound[i][j], nullptr);
+#endif
 				sePlaySound[i][j] = nullptr;
 			}
 		}
@@ -15,6 +15,12 @@ u32 JASAramStream::sChannelMax;
 bool JASAramStream::sSystemPauseFlag;
 bool JASAramStream::sFatalErrorFlag;
 
+#if FOR_MODDING
+u32 JASAramStream::sUrgentLoadNum    = 2;
+u32 JASAramStream::sUrgentReadNum    = 0;
+u32 JASAramStream::sUnderrunTotalNum = 0;
+#endif
+
 static const s16 OSC_RELEASE_TABLE[6] = {
 	0, 2, 0, 15, 0, 0,
 };
@@ -223,6 +229,10 @@ void JASAramStream::init(u32 dataOffs, u32 dataLen, JASAramStreamCallback callba
 	_244        = p4;
 	OSInitMessageQueue(&mMsgQueueA, mMsgSlotsA, ARRAY_SIZE(mMsgSlotsA));
 	OSInitMessageQueue(&mMsgQueueB, mMsgSlotsB, ARRAY_SIZE(mMsgSlotsB));
+#if FOR_MODDING
+	mPeakLoadedCount = 0;
+	mUnderrunNum     = 0;
+#endif
 	/*
 	.loc_0x0:
 	  stwu      r1, -0x10(r1)
@@ -434,6 +444,13 @@ void JASAramStream::finishTask(void* args)
 {
 	JASDriver::rejectCallback(channelProcCallback, args);
 	JASAramStream* stream = static_cast<JASAramStream*>(args);
+#if FOR_MODDING
+#if DEBUG
+	// per-stream report, to compare runs with and without urgent reads (sUrgentLoadNum)
+	OSReport("JASAramStream: %d underruns, %d loads queued at peak, %d urgent reads so far\n", stream->mUnderrunNum,
+	         stream->mPeakLoadedCount, sUrgentReadNum);
+#endif
+#endif
 	if (stream->mCallback != nullptr) {
 		stream->mCallback(0, stream, stream->_244);
 		stream->mCallback = nullptr;
@@ -556,10 +573,24 @@ bool JASAramStream::load()
 		length = mFileInfo.length - offset;
 	}
 
+#if FOR_MODDING
+	// playback is closing in on data that hasn't arrived yet; jump ahead of other reads
+	s32 prio = 1;
+	if (mLoadedCount >= sUrgentLoadNum) {
+		prio = 0;
+		sUrgentReadNum++;
+	}
+
+	if (DVDReadPrio(&mFileInfo, sReadBuffer, length, offset, prio) < 0) {
+		sFatalErrorFlag = true;
+		return false;
+	}
+#else
 	if (DVDReadPrio(&mFileInfo, sReadBuffer, length, offset, 1) < 0) {
 		sFatalErrorFlag = true;
 		return false;
 	}
+#endif
 
 	u32* preBuffer = (u32*)sReadBuffer;
 	u32 size       = mDataOffset + (mCurrentLoadIndex * sBlockSize);
@@ -1042,6 +1073,15 @@ void JASAramStream::updateChannel(u32 command, JASChannel* chan, JASDsp::TChanne
 
 			mNextBlockSample = dspChan->mCurrentSampleOffset + dspChan->mSamplesPerBlock;
 
+#if FOR_MODDING
+			if (mLoadedCount > mPeakLoadedCount) {
+				mPeakLoadedCount = mLoadedCount;
+			}
+			if (mLoadedCount >= mBlockCount - 2 && !(mPauseFlags & 4)) {
+				mUnderrunNum++;
+				sUnderrunTotalNum++;
+			}
+#endif
 			if (mLoadedCount >= mBlockCount - 2) {
 				mPauseFlags |= 4;
 			}
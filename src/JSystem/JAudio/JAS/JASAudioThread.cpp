@@ -58,7 +58,11 @@ void* JASAudioThread::run()
 	JASDSPChannel::initAll();
 
 	JASSingletonHolder<JASMemPool<JASChannel, JASThreadingModel::SingleThreaded>, JASCreationPolicy::NewFromRootHeap>::getInstance()
+#if FOR_MODDING
+	    ->newMemPool(sizeof(JASChannel), 0x48);
+#else
 	    ->newMemPool(0x118, 0x48);
+#endif
 	JASDriver::startDMA();
 
 	while (true) {
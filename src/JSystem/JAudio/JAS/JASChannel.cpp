@@ -20,6 +20,12 @@ enum CalcStyle {
 	CALC_WEIGHT = 2, // add component weighted by power
 };
 
+#if FOR_MODDING
+bool JASChannel::useMixerCache     = true;
+u32 JASChannel::sMixerCacheHitNum  = 0;
+u32 JASChannel::sMixerCacheMissNum = 0;
+#endif
+
 const u8 JASChannel::calc_sw_table[27][3] = {
 	// sound, effect, channel
 	{ CALC_NONE, CALC_NONE, CALC_NONE },       // 0, null
@@ -94,6 +100,9 @@ JASChannel::JASChannel(Callback callback, void* cbData)
 	mVolumeChannel = 1.0f;
 	mPitchChannel  = 1.0f;
 	mPauseFlag     = false;
+#if FOR_MODDING
+	mMixerCacheValid = false;
+#endif
 }
 
 /**
@@ -217,7 +226,13 @@ void JASChannel::setOscInit(int index, const JASOscillator::Data* data) { mOscil
  * @note Address: 0x800A3578
  * @note Size: 0x10
  */
-void JASChannel::setMixConfig(int index, u16 mixConfig) { mMixConfigs[index].mWhole = mixConfig; }
+void JASChannel::setMixConfig(int index, u16 mixConfig)
+{
+	mMixConfigs[index].mWhole = mixConfig;
+#if FOR_MODDING
+	mMixerCacheValid = false;
+#endif
+}
 
 /**
  * @note Address: 0x800A3588
@@ -658,6 +673,28 @@ void JASChannel::updateAutoMixer(JASDsp::TChannel* dspChan, f32 volume, f32 pan,
  */
 void JASChannel::updateMixer(f32 volume, f32 pan, f32 fxmix, f32 dolby, u16* outVolume)
 {
+#if FOR_MODDING
+	// most voices hold their volume and pan for many frames, so skip the six bus evaluations
+	// (and their sines) when nothing feeding them has changed. the outputs are bit-identical.
+	u16 level       = JASDriver::getChannelLevel();
+	bool isCacheHit = false;
+	if (useMixerCache) {
+		if (mMixerCacheValid && mMixerCacheInput[0] == volume && mMixerCacheInput[1] == pan && mMixerCacheInput[2] == fxmix
+		    && mMixerCacheInput[3] == dolby && mMixerCacheLevel == level) {
+			sMixerCacheHitNum++;
+			isCacheHit = true;
+#if !DEBUG
+			for (u32 i = 0; i < 6; i++) {
+				outVolume[i] = mMixerCacheVolume[i];
+			}
+			return;
+#endif
+		} else {
+			sMixerCacheMissNum++;
+		}
+	}
+#endif
+
 	for (u32 i = 0; i < 6; i++) {
 		f32 vol          = volume;
 		MixConfig config = mMixConfigs[i];
@@ -739,6 +776,30 @@ void JASChannel::updateMixer(f32 volume, f32 pan, f32 fxmix, f32 dolby, u16* out
 			outVolume[i] = JASCalc::clamp01(vol) * JASDriver::getChannelLevel();
 		}
 	}
+
+#if FOR_MODDING
+#if DEBUG
+	// debug builds still mix a cache hit the long way and check that the cache agrees
+	if (isCacheHit) {
+		for (u32 i = 0; i < 6; i++) {
+			if (outVolume[i] != mMixerCacheVolume[i]) {
+				OSReport("JASChannel: mixer cache bus %d gave %d, mixer %d\n", i, mMixerCacheVolume[i], outVolume[i]);
+			}
+		}
+	}
+#endif
+	if (useMixerCache) {
+		mMixerCacheInput[0] = volume;
+		mMixerCacheInput[1] = pan;
+		mMixerCacheInput[2] = fxmix;
+		mMixerCacheInput[3] = dolby;
+		mMixerCacheLevel    = level;
+		for (u32 i = 0; i < 6; i++) {
+			mMixerCacheVolume[i] = outVolume[i];
+		}
+		mMixerCacheValid = true;
+	}
+#endif
 }
 
 /**
@@ -20,6 +20,9 @@ JASHeap::JASHeap(JASDisposer* disposer)
     , mLastChild(0)
 {
 	OSInitMutex(&mMutex);
+#if FOR_MODDING
+	mChildSize = 0;
+#endif
 }
 
 /**
@@ -80,7 +83,13 @@ bool JASHeap::alloc(JASHeap* parent, u32 size)
 	if (!parent->isAllocated()) {
 		return false;
 	}
-	size           = OSRoundUp32B(size);
+	size = OSRoundUp32B(size);
+#if FOR_MODDING
+	// no hole can be big enough if all the free space together isn't
+	if (parent->getTotalFreeSize() < size) {
+		return false;
+	}
+#endif
 	u32 curOffset  = parent->getCurOffset();
 	u32 tailOffset = parent->getTailOffset();
 	if (curOffset + size <= tailOffset) {
@@ -103,6 +112,12 @@ bool JASHeap::alloc(JASHeap* parent, u32 size)
 			base              = minBase;
 			minOffset         = offset;
 			hasFoundNewOffset = true;
+#if FOR_MODDING
+			// an exact fit can't be beaten
+			if (offset == size) {
+				break;
+			}
+#endif
 		}
 		u32 curSize = it->mSize;
 		minBase     = (u8*)it->mBase + curSize;
@@ -187,6 +202,9 @@ bool JASHeap::free()
 			}
 		}
 		parentTree->removeChild(&mTree);
+#if FOR_MODDING
+		parentHeap->mChildSize -= mSize;
+#endif
 	}
 	mBase      = nullptr;
 	mLastChild = nullptr;
@@ -223,6 +241,19 @@ void JASHeap::freeAll()
 int JASHeap::getTotalFreeSize() const
 {
 	// UNUSED FUNCTION
+#if FOR_MODDING
+#if DEBUG
+	// debug builds check the running total against a walk over the children
+	u32 childSize = 0;
+	for (JSUTreeIterator<JASHeap> it = mTree.getFirstChild(); it != mTree.getEndChild(); it++) {
+		childSize += it->mSize;
+	}
+	if (childSize != mChildSize) {
+		OSReport("JASHeap: children hold %d bytes, mChildSize %d\n", childSize, mChildSize);
+	}
+#endif
+	return mSize - mChildSize;
+#endif
 }
 
 /**
@@ -232,6 +263,27 @@ int JASHeap::getTotalFreeSize() const
 int JASHeap::getFreeSize() const
 {
 	// UNUSED FUNCTION
+#if FOR_MODDING
+	// largest single hole between children, or after the last one. the holes add up to
+	// mSize - mChildSize, so the walk stops once the holes not yet seen can't beat the best one
+	u32 unseenSize = mSize - mChildSize;
+	u32 maxSize    = 0;
+	u8* curBase    = mBase;
+	for (JSUTreeIterator<JASHeap> it = mTree.getFirstChild(); it != mTree.getEndChild() && maxSize < unseenSize; it++) {
+		u32 holeSize = it->mBase - curBase;
+		if (holeSize > maxSize) {
+			maxSize = holeSize;
+		}
+		unseenSize -= holeSize;
+		curBase = it->mBase + it->mSize;
+	}
+
+	// whatever is left unseen is the tail hole, or less than maxSize anyway
+	if (unseenSize > maxSize) {
+		maxSize = unseenSize;
+	}
+	return maxSize;
+#endif
 }
 
 /**
@@ -365,6 +417,9 @@ void JASHeap::insertChild(JASHeap* heap, JASHeap* next, void* base, u32 size, bo
 	heap->mSize      = size;
 	heap->mLastChild = nullptr;
 	mTree.insertChild(&next->mTree, &heap->mTree);
+#if FOR_MODDING
+	mChildSize += size;
+#endif
 }
 
 /**
@@ -484,6 +539,10 @@ JASGenericMemPool::JASGenericMemPool()
 	mNextFreeBlock  = nullptr;
 	mFirstFreeBlock = nullptr;
 	mFreeMemCount   = 0;
+#if FOR_MODDING
+	mMinFreeMemCount = -1;
+	mAllocFailNum    = 0;
+#endif
 }
 
 /**
@@ -501,6 +560,41 @@ JASGenericMemPool::~JASGenericMemPool()
  */
 void JASGenericMemPool::newMemPool(u32 size, int memCount)
 {
+#if FOR_MODDING
+	// carve the blocks out of one allocation so pooled objects sit together in memory,
+	// threaded in the same order as the per-block version below
+	if (memCount > 0) {
+		u8* mems = new (JASDram, 0) u8[size * memCount];
+		for (int i = 0; i < memCount; i++) {
+			u8* mem        = mems + i * size;
+			((u32*)mem)[0] = (u32)mNextFreeBlock;
+			mNextFreeBlock = (void**)mem;
+
+			if (mFirstFreeBlock == nullptr) {
+				mFirstFreeBlock = (void**)mem;
+			}
+		}
+		mFreeMemCount += memCount;
+
+		// start the low-water mark when the pool is first created; later growth shifts it
+		// by the same amount so the peak usage it records is kept
+		if (mMinFreeMemCount < 0) {
+			mMinFreeMemCount = mFreeMemCount;
+		} else {
+			mMinFreeMemCount += memCount;
+		}
+	}
+#if DEBUG
+	// debug builds check the slab was threaded into a free list as long as the per-block one would be
+	int freeNum = 0;
+	for (void** mem = mNextFreeBlock; mem != nullptr; mem = (void**)mem[0]) {
+		freeNum++;
+	}
+	if (freeNum != mFreeMemCount) {
+		OSReport("JASGenericMemPool: %d blocks on the free list, mFreeMemCount %d\n", freeNum, mFreeMemCount);
+	}
+#endif
+#else
 	for (int i = 0; i < memCount; i++) {
 		u8* mems = new (JASDram, 0) u8[size];
 		// some nonsense here, but it works, the data type of _00/_04 is probably wrong
@@ -513,6 +607,7 @@ void JASGenericMemPool::newMemPool(u32 size, int memCount)
 		}
 	}
 	mFreeMemCount += memCount;
+#endif
 }
 
 /**
@@ -523,11 +618,19 @@ void* JASGenericMemPool::alloc(u32)
 {
 	void** mem = mNextFreeBlock;
 	if (mem == nullptr) {
+#if FOR_MODDING
+		mAllocFailNum++;
+#endif
 		return nullptr;
 	}
 
 	mNextFreeBlock = (void**)mem[0];
 	mFreeMemCount--;
+#if FOR_MODDING
+	if (mFreeMemCount < mMinFreeMemCount) {
+		mMinFreeMemCount = mFreeMemCount;
+	}
+#endif
 	if (mNextFreeBlock == nullptr) {
 		mFirstFreeBlock = nullptr;
 	}
@@ -1,4 +1,5 @@
 #include "JSystem/JAudio/JAS/JASSeqCtrl.h"
+#include "Dolphin/os.h"
 
 /**
  * @note Address: 0x8009C858
@@ -151,9 +152,23 @@ u32 JASSeqCtrl::get32(u32 offset) const
  */
 u32 JASSeqCtrl::read16()
 {
+#if FOR_MODDING
+	// fetch through a local so the cursor is loaded and stored once, not once per byte
+	const u8* ptr   = mCurrentFilePtr;
+	mCurrentFilePtr = (u8*)ptr + 2;
+	u32 result      = (ptr[0] << 8) | ptr[1];
+#if DEBUG
+	// debug builds check the operand against the offset-based reader
+	if (result != get16(ptr - mRawFilePtr)) {
+		OSReport("JASSeqCtrl: read16 at %x gave %x\n", ptr - mRawFilePtr, result);
+	}
+#endif
+	return result;
+#else
 	u32 result = *(mCurrentFilePtr++) << 8;
 	result |= *(mCurrentFilePtr++);
 	return result;
+#endif
 }
 
 /**
@@ -162,11 +177,23 @@ u32 JASSeqCtrl::read16()
  */
 u32 JASSeqCtrl::read24()
 {
+#if FOR_MODDING
+	const u8* ptr   = mCurrentFilePtr;
+	mCurrentFilePtr = (u8*)ptr + 3;
+	u32 result      = (ptr[0] << 16) | (ptr[1] << 8) | ptr[2];
+#if DEBUG
+	if (result != get24(ptr - mRawFilePtr)) {
+		OSReport("JASSeqCtrl: read24 at %x gave %x\n", ptr - mRawFilePtr, result);
+	}
+#endif
+	return result;
+#else
 	u32 result = *(mCurrentFilePtr++) << 8;
 	result |= *(mCurrentFilePtr++);
 	result <<= 8;
 	result |= *(mCurrentFilePtr++);
 	return result;
+#endif
 }
 
 /**
@@ -1680,10 +1680,19 @@ int JASSeqParser::parseSeq(JASTrack* track)
 			val23 = cmdNoteOn(track, flag);
 		} else if (((flag & 0xF0) == 128) && !(flag & 0x3)) {
 			int val = 0;
+#if FOR_MODDING
+			// wait lengths are 0-3 bytes wide; walk them through a local cursor
+			const u8* ptr = track->mSeqCtrl.mCurrentFilePtr;
+			for (int i = 0; i < (128 - flag); i++) {
+				val = (val << 8) | *ptr++;
+			}
+			track->mSeqCtrl.mCurrentFilePtr = (u8*)ptr;
+#else
 			for (int i = 0; i < (128 - flag); i++) {
 				val <<= 8;
 				val |= *track->mSeqCtrl.mCurrentFilePtr++;
 			}
+#endif
 			track->mSeqCtrl.mWaitTimer = val;
 			val23                      = val != 0;
 		} else if (((flag & 0xF0) == 128) || flag == (u32)0xF9) {
@@ -18,6 +18,12 @@ JASSeqParser JASTrack::sParser;
 JASTrack* JASTrack::sFreeList;
 JASTrack* JASTrack::sFreeListEnd;
 
+#if FOR_MODDING
+bool JASTrack::usePitchCentCache      = true;
+u32 JASTrack::sPitchCentCacheHitNum  = 0;
+u32 JASTrack::sPitchCentCacheMissNum = 0;
+#endif
+
 /**
  * @note Address: 0x8009EF94
  * @note Size: 0x12C
@@ -52,6 +58,9 @@ JASTrack::JASTrack()
 	for (int i = 0; i < 12; i++) {
 		_2E0[i] = JASPlayer::sAdsTable[i];
 	}
+#if FOR_MODDING
+	mPitchCentCacheValid = false;
+#endif
 	JASCalc::bzero(&mTimedParam, sizeof(TimedParam_));
 }
 
@@ -393,6 +402,9 @@ void JASTrack::initTimed()
 	mTimedParam.mMoveParams[TIMED_IIR_Unk2].set(0.0f);
 	mTimedParam.mMoveParams[TIMED_IIR_Unk3].set(0.0f);
 	mTimedParam.mMoveParams[TIMED_Unk5].set(0.0f);
+#if FOR_MODDING
+	mPitchCentCacheValid = false;
+#endif
 }
 
 /**
@@ -724,7 +736,11 @@ void JASTrack::updateTrackAll()
 		vol = 0.0f;
 	}
 
+#if FOR_MODDING
+	f32 cent = calcPitchCent();
+#else
 	f32 cent = JASPlayer::pitchToCent(mTimedParam.mInnerParam.mPitch.mCurrentValue, mRegisterParam._0E);
+#endif
 	pitch    = cent * mVibrate.getValue();
 
 	pan   = mTimedParam.mInnerParam.mPan.mCurrentValue;
@@ -832,7 +848,11 @@ void JASTrack::updateTrack(u32 flag)
 
 	u32 isPitch = flag & OUTERPARAM_Pitch;
 	if (isPitch) {
+#if FOR_MODDING
+		pitch = calcPitchCent();
+#else
 		pitch = JASPlayer::pitchToCent(mTimedParam.mInnerParam.mPitch.mCurrentValue, f32(mRegisterParam._0E));
+#endif
 		pitch *= mVibrate.getValue();
 		if (mExtBuffer && mExtBuffer->checkOuterSwitch(OUTERPARAM_Pitch)) {
 			pitch *= mExtBuffer->mPitch;
@@ -3265,6 +3285,39 @@ f32 JASTrack::panCalc(f32 valA, f32 valB, f32 weight, u8 calcType)
 	return 0.0f;
 }
 
+#if FOR_MODDING
+/**
+ * Converts the track's timed pitch to a frequency ratio. updateTimedParam flags pitch
+ * every tick for vibrato, so most calls repeat the previous conversion exactly.
+ */
+f32 JASTrack::calcPitchCent()
+{
+	f32 pitch = mTimedParam.mInnerParam.mPitch.mCurrentValue;
+	f32 range = f32(mRegisterParam._0E);
+	if (usePitchCentCache) {
+		if (mPitchCentCacheValid && mPitchCentCacheInput == pitch && mPitchCentCacheRange == range) {
+			sPitchCentCacheHitNum++;
+#if DEBUG
+			// debug builds check the cached ratio against a fresh conversion
+			f32 check = JASPlayer::pitchToCent(pitch, range);
+			if (check != mPitchCentCacheOutput) {
+				OSReport("JASTrack: pitch cache gave %f, pitchToCent %f\n", mPitchCentCacheOutput, check);
+			}
+#endif
+			return mPitchCentCacheOutput;
+		}
+		sPitchCentCacheMissNum++;
+	}
+
+	f32 cent              = JASPlayer::pitchToCent(pitch, range);
+	mPitchCentCacheInput  = pitch;
+	mPitchCentCacheRange  = range;
+	mPitchCentCacheOutput = cent;
+	mPitchCentCacheValid  = true;
+	return cent;
+}
+#endif
+
 /**
  * @note Address: 0x800A2658
  * @note Size: 0xF4
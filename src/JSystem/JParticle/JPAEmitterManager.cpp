@@ -31,6 +31,10 @@ JPAEmitterManager::JPAEmitterManager(u32 ptclNum, u32 emtrNum, JKRHeap* heap, u8
 	}
 
 	mWorkData = new (heap, 0) JPAEmitterWorkData;
+#if FOR_MODDING
+	mCalcFilter    = nullptr;
+	mCalcFilterArg = nullptr;
+#endif
 }
 
 /**
@@ -110,9 +114,27 @@ void JPAEmitterManager::createSimpleEmitter(const JGeometry::TVec3f&, u16, JPAEm
  * @note Address: N/A
  * @note Size: 0x90
  */
-void JPAEmitterManager::calc(u8)
+void JPAEmitterManager::calc(u8 groupID)
 {
+#if FOR_MODDING
+	// calc a single group, so callers can update groups independently of each other
+	JSUPtrLink* link = mGrpEmtr[groupID].getFirst();
+	while (link) {
+		JPABaseEmitter* emit = (JPABaseEmitter*)link->getObjectPtr();
+		link                 = link->getNext();
+		bool stat;
+		if (mCalcFilter && !mCalcFilter(emit, mCalcFilterArg)) {
+			stat = emit->mResource->calcIdle(mWorkData, emit);
+		} else {
+			stat = emit->mResource->calc(mWorkData, emit);
+		}
+		if (stat && !emit->isFlag(JPAEMIT_Unk10)) {
+			forceDeleteEmitter(emit);
+		}
+	}
+#else
 	// UNUSED FUNCTION
+#endif
 }
 
 /**
@@ -121,6 +143,13 @@ void JPAEmitterManager::calc(u8)
  */
 void JPAEmitterManager::calc()
 {
+#if FOR_MODDING
+	for (u8 i = 0; i < mGrpMax; i++) {
+		if (mGrpEmtr[i].getNumLinks() != 0) {
+			calc(i);
+		}
+	}
+#else
 	JSUPtrLink* link;
 	JPABaseEmitter* emit;
 	for (u8 i = 0; i < mGrpMax; i++) {
@@ -134,6 +163,7 @@ void JPAEmitterManager::calc()
 			}
 		}
 	}
+#endif
 }
 
 /**
@@ -59,6 +59,9 @@ JPAResource::JPAResource()
 	mKeyBlockNum                  = 0;
 	mFieldBlockNum                = 0;
 	mUsrIdx                       = 0;
+#if FOR_MODDING
+	mHasUniformFields = false;
+#endif
 }
 
 /**
@@ -67,6 +70,20 @@ JPAResource::JPAResource()
  */
 void JPAResource::init(JKRHeap* heap)
 {
+#if FOR_MODDING
+	// Gravity and Air (without speed clamping) only add the vector built in prepare, so when no field fades
+	// calcField can apply them without going through the per-particle virtual calc.
+	mHasUniformFields = mFieldBlockNum != 0;
+	for (int i = 0; i < mFieldBlockNum; i++) {
+		JPAFieldBlock* block = mFieldBlocks[i];
+		u32 type             = block->getType();
+		if (block->checkStatus(0x8 | 0x30 | 0x40) || !(type == JPAFIELD_Gravity || (type == JPAFIELD_Air && !block->checkStatus(4)))) {
+			mHasUniformFields = false;
+			break;
+		}
+	}
+#endif
+
 	JPAExtraShape* exShape          = mExtraShape;
 	const JPABaseShapeData* shpData = mBaseShape->mData;
 
@@ -2851,6 +2868,47 @@ lbl_800970E4:
 	*/
 }
 
+#if FOR_MODDING
+/**
+ * Cut-down calc for an emitter that is not emitting and has no live particles. Keeps the emitter's
+ * clock, termination and callbacks running like calc does, but skips the key, field and emission work,
+ * so a caller can run this on frames it wants to save and still have the emitter age and die on time.
+ */
+bool JPAResource::calcIdle(JPAEmitterWorkData* data, JPABaseEmitter* emitter)
+{
+	if (emitter->isFlag(JPAEMIT_StopCalc) || emitter->getParticleNumber() != 0) {
+		return calc(data, emitter);
+	}
+
+	data->mEmitter      = emitter;
+	data->mResource     = this;
+	data->mCreateNumber = 0;
+
+	if (emitter->processTillStartFrame()) {
+		return false;
+	}
+
+	if (emitter->processTermination()) {
+		return false;
+	}
+
+	if (emitter->mEmitterCallback) {
+		emitter->mEmitterCallback->execute(emitter);
+		if (emitter->isFlag(JPAEMIT_ForceDelete)) {
+			return true;
+		}
+
+		emitter->mEmitterCallback->executeAfter(emitter);
+		if (emitter->isFlag(JPAEMIT_ForceDelete)) {
+			return true;
+		}
+	}
+
+	emitter->mCurrentFrame++;
+	return false;
+}
+#endif
+
 /**
  * @note Address: 0x800970F8
  * @note Size: 0xF0
@@ -3679,6 +3737,26 @@ void JPAResource::calc_c(JPAEmitterWorkData* workData, JPABaseParticle* particle
  */
 void JPAResource::calcField(JPAEmitterWorkData* workData, JPABaseParticle* particle)
 {
+#if FOR_MODDING
+	if (mHasUniformFields) {
+		for (int i = mFieldBlockNum - 1; 0 <= i; i--) {
+			JPAFieldBlock* block = mFieldBlocks[i];
+			switch (block->getAddType()) {
+			case 0:
+				particle->mVelType0.add(block->mField->_04);
+				break;
+			case 1:
+				particle->mVelType1.add(block->mField->_04);
+				break;
+			case 2:
+				particle->mVelType2.add(block->mField->_04);
+				break;
+			}
+		}
+		return;
+	}
+#endif
+
 	for (int i = mFieldBlockNum - 1; 0 <= i; i--) {
 		mFieldBlocks[i]->mField->calc(workData, mFieldBlocks[i], particle);
 	}
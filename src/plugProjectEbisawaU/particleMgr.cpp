@@ -22,6 +22,10 @@ bool ParticleMgr::disableCulling;
 f32 ParticleMgr::mClipRadiusS = 10.0f;
 f32 ParticleMgr::mClipRadiusM = 30.0f;
 f32 ParticleMgr::mClipRadiusL = 100.0f;
+#if FOR_MODDING
+// off-screen emitters with nothing alive only get calc'd every this many frames (1 = every frame)
+u8 ParticleMgr::mCulledCalcInterval = 4;
+#endif
 
 /**
  * @note Address: 0x803BAF70
@@ -59,6 +63,11 @@ ParticleMgr::ParticleMgr()
 	mReferencedViewportCount = 0;
 	mUnusedVal               = 200;
 	mLightMgr                = nullptr;
+#if FOR_MODDING
+	mCalcFrame           = 0;
+	mCulledEmitterNum    = 0;
+	mThrottledEmitterNum = 0;
+#endif
 }
 
 /**
@@ -179,10 +188,77 @@ void ParticleMgr::killAll() { mEmitterManager->forceDeleteAllEmitter(); }
  */
 void ParticleMgr::update()
 {
+#if FOR_MODDING
+	calcEmitters();
+#else
 	mEmitterManager->calc();
+#endif
 	pkEffectMgr->resetContextS();
 }
 
+#if FOR_MODDING
+/**
+ * JPAEmitterManager calc filter: counts emitters that are culled and idle, and limits them to
+ * JPAResource::calcIdle except on every mCulledCalcInterval-th frame.
+ */
+static bool throttleCulledEmitter(JPABaseEmitter* emit, void* arg)
+{
+	ParticleMgr* mgr = static_cast<ParticleMgr*>(arg);
+	if (!mgr->isEmitterCulled(emit)) {
+		return true;
+	}
+
+	mgr->mCulledEmitterNum++;
+	if (ParticleMgr::mCulledCalcInterval <= 1 || (mgr->mCalcFrame % ParticleMgr::mCulledCalcInterval) == 0) {
+		return true;
+	}
+
+	mgr->mThrottledEmitterNum++;
+	return false;
+}
+
+/**
+ * Runs JPAEmitterManager::calc, but emitters that were clipped by cullByResFlg and have no live particles
+ * only get a full calc every mCulledCalcInterval frames while they stay off-screen. On the other frames
+ * they still age, handle termination and run their callbacks, so lifetimes, force-deletes and follow
+ * positions stay current and cullByResFlg re-checks visibility every frame.
+ */
+void ParticleMgr::calcEmitters()
+{
+	mCulledEmitterNum    = 0;
+	mThrottledEmitterNum = 0;
+
+	mEmitterManager->setCalcFilter(throttleCulledEmitter, this);
+	mEmitterManager->calc();
+	mEmitterManager->setCalcFilter(nullptr, nullptr);
+	mCalcFrame++;
+}
+
+/**
+ * Checks whether an emitter is hidden by cullByResFlg, has nothing alive and is still outside every viewport.
+ */
+bool ParticleMgr::isEmitterCulled(JPABaseEmitter* emit)
+{
+	if (disableCulling || !emit->isFlag(JPAEMIT_StopDraw) || !emit->isFlag(JPAEMIT_StopEmitting) || emit->getParticleNumber() != 0) {
+		return false;
+	}
+
+	u32 flag = emit->mResource->mDynamicsBlock->getResUserWork();
+	f32 radius;
+	if (flag & 0x20) {
+		radius = (flag & 0x10) ? mClipRadiusL : mClipRadiusM;
+	} else if (flag & 0x10) {
+		radius = mClipRadiusS;
+	} else {
+		return false;
+	}
+
+	Vector3f pos(emit->mGlobalTrs.x, emit->mGlobalTrs.y, emit->mGlobalTrs.z);
+	Sys::Sphere bound(pos, radius);
+	return cull(bound);
+}
+#endif
+
 /**
  * @note Address: 0x803BB7E4
  * @note Size: 0x2C
@@ -8,6 +8,111 @@ static const char className[] = "generatorCache";
 
 GeneratorCache* generatorCache;
 
+#if FOR_MODDING
+/**
+ * Stream over the cache heap, used in place of RamStream, that zero-run packs what it writes and unpacks what it reads.
+ * Cached generators, creatures and pikiheads are mostly small ints, shorts and zeroed floats,
+ * so each run of zero bytes is stored as a 0 followed by the run length (1-255).
+ * Unpacked courses (loaded from legacy saves) go through the same stream as plain bytes.
+ * mPosition counts unpacked bytes, getUsedSize() the bytes actually taken in the heap.
+ */
+struct CacheStream : public Stream {
+	CacheStream(void* buffer, int bounds, bool isPacked)
+	{
+		mBuffer    = (u8*)buffer;
+		mBounds    = bounds;
+		mIsPacked  = isPacked;
+		mPackedPos = 0;
+		mZeroRun   = 0;
+	}
+
+	virtual void read(void* dest, int length) // _04
+	{
+		u8* out = (u8*)dest;
+		if (!mIsPacked) {
+			checkBounds(mPosition + length);
+			memcpy(out, mBuffer + mPosition, length);
+			return;
+		}
+
+		for (int i = 0; i < length; i++) {
+			if (mZeroRun) {
+				mZeroRun--;
+				out[i] = 0;
+				continue;
+			}
+
+			checkBounds(mPackedPos + 1);
+			u8 byte = mBuffer[mPackedPos++];
+			if (byte == 0) {
+				checkBounds(mPackedPos + 1);
+				mZeroRun = mBuffer[mPackedPos++] - 1;
+			}
+			out[i] = byte;
+		}
+	}
+
+	virtual void write(void* src, int length) // _08
+	{
+		u8* in = (u8*)src;
+		if (!mIsPacked) {
+			checkBounds(mPosition + length);
+			memcpy(mBuffer + mPosition, in, length);
+			return;
+		}
+
+		for (int i = 0; i < length; i++) {
+			if (in[i] == 0) {
+				if (++mZeroRun == 255) {
+					flush();
+				}
+				continue;
+			}
+
+			flush();
+			checkBounds(mPackedPos + 1);
+			mBuffer[mPackedPos++] = in[i];
+		}
+	}
+
+	virtual bool eof() // _0C
+	{
+		if (!mIsPacked) {
+			return mBounds <= mPosition;
+		}
+		return mBounds <= mPackedPos && mZeroRun == 0;
+	}
+
+	/**
+	 * Writes out any pending zero run. Call after each saved object so the next one starts clean.
+	 */
+	void flush()
+	{
+		if (mZeroRun) {
+			checkBounds(mPackedPos + 2);
+			mBuffer[mPackedPos++] = 0;
+			mBuffer[mPackedPos++] = mZeroRun;
+			mZeroRun              = 0;
+		}
+	}
+
+	int getUsedSize() const { return mIsPacked ? mPackedPos : mPosition; }
+
+	void checkBounds(int end)
+	{
+		if (end > mBounds) {
+			JUT_PANIC("CacheStream out of bounds (pos=%d,bound=%d)\n", end, mBounds);
+		}
+	}
+
+	u8* mBuffer;    // _418
+	int mBounds;    // _41C
+	int mPackedPos; // _420
+	int mZeroRun;   // _424
+	bool mIsPacked; // _428
+};
+#endif
+
 /**
  * @note Address: 0x801F1908
  * @note Size: 0x88
@@ -126,7 +231,11 @@ int CourseCache::getColorMePikmins(u8* buffer, int pikminType)
 	int pikiheadFlags;
 	int count = 0;
 
+#if FOR_MODDING
+	CacheStream stream(getOffsetBuffer(buffer, mCreatureSize), mPikiheadSize, mIsPacked);
+#else
 	RamStream stream(getOffsetBuffer(buffer, mCreatureSize), mPikiheadSize);
+#endif
 	for (int i = 0; i < mPikiheadCount; i++) {
 		pikiheadFlags = stream.readByte();
 
@@ -192,7 +301,11 @@ void GeneratorCache::loadGenerators(int courseIndex)
 {
 	mCurrentCache = findCache(mRootCache, courseIndex);
 	if (mCurrentCache) {
+#if FOR_MODDING
+		CacheStream input(mHeapBuffer + mCurrentCache->mOffset, mCurrentCache->mSize, mCurrentCache->mIsPacked);
+#else
 		RamStream input(mHeapBuffer + mCurrentCache->mOffset, mCurrentCache->mSize);
+#endif
 		for (int i = 0; i < mCurrentCache->mGeneratorCount; i++) {
 			Generator* generator = new Generator;
 
@@ -220,7 +333,11 @@ void GeneratorCache::loadCreatures(int courseIndex)
 {
 	mCurrentCache = findCache(mRootCache, courseIndex);
 	if (mCurrentCache) {
+#if FOR_MODDING
+		CacheStream input(mCurrentCache->getOffsetBuffer(mHeapBuffer, 0), mCurrentCache->mCreatureSize, mCurrentCache->mIsPacked);
+#else
 		RamStream input(mCurrentCache->getOffsetBuffer(mHeapBuffer, 0), mCurrentCache->mCreatureSize);
+#endif
 		for (int i = 0; i < mCurrentCache->mCreatureCount; i++) {
 			int id         = input.readInt();
 			Generator* gen = findRamGenerator(id);
@@ -252,7 +369,11 @@ void GeneratorCache::loadCreatures(int courseIndex)
 void GeneratorCache::loadPikiheads()
 {
 	CourseCache* cache = mCurrentCache;
+#if FOR_MODDING
+	CacheStream input(cache->getOffsetBuffer(mHeapBuffer, cache->mCreatureSize), cache->mPikiheadSize, cache->mIsPacked);
+#else
 	RamStream input(cache->getOffsetBuffer(mHeapBuffer, cache->mCreatureSize), cache->mPikiheadSize);
+#endif
 	for (int i = 0; i < mCurrentCache->mPikiheadCount; i++) {
 		ItemPikihead::Item* piki = ItemPikihead::mgr->birth();
 		ItemPikihead::InitArg arg;
@@ -278,9 +399,13 @@ void GeneratorCache::slideCache()
 		destinationBuffer = (u8*)cache->getOffsetBufferNoGen(mHeapBuffer, cacheSize);
 		sourceBuffer      = (u8*)mHeapBuffer + cache->mOffset;
 
+#if FOR_MODDING
+		memmove(destinationBuffer, sourceBuffer, cache->mSize);
+#else
 		for (int index = 0; index < cache->mSize; index++) {
 			*destinationBuffer++ = *sourceBuffer++;
 		}
+#endif
 
 		cache->mOffset -= cacheSize;
 	}
@@ -363,12 +488,21 @@ void GeneratorCache::saveGenerator(Generator* generator)
 {
 	if (generator->mDayLimit == -1 || gameSystem->mTimeMgr->mDayCount < generator->mDayLimit) {
 		if (generator->need_saveCreature()) {
+#if FOR_MODDING
+			CacheStream output(mHeapBuffer + mFreeOffset, mFreeSize, true);
+#else
 			RamStream output(mHeapBuffer + mFreeOffset, mFreeSize);
+#endif
 			generator->mIndex = mCurrentCache->mGeneratorCount;
 
 			Generator::ramMode = Generator::RM_MemoryCache;
 			generator->write(output);
-			int newPos         = output.mPosition;
+#if FOR_MODDING
+			output.flush();
+			int newPos = output.getUsedSize();
+#else
+			int newPos = output.mPosition;
+#endif
 			Generator::ramMode = Generator::RM_Disc;
 
 			mFreeOffset += newPos;
@@ -390,7 +524,11 @@ void GeneratorCache::saveCreature(Generator* gen)
 		return;
 	}
 
+#if FOR_MODDING
+	CacheStream output(mHeapBuffer + mFreeOffset, mFreeSize, true);
+#else
 	RamStream output(mHeapBuffer + mFreeOffset, mFreeSize);
+#endif
 	Generator::ramMode = Generator::RM_MemoryCache;
 	if (gen->need_saveCreature()) {
 		output.writeInt(gen->mIndex);
@@ -405,7 +543,12 @@ void GeneratorCache::saveCreature(Generator* gen)
 	}
 
 	Generator::ramMode = Generator::RM_Disc;
-	int size           = output.mPosition;
+#if FOR_MODDING
+	output.flush();
+	int size = output.getUsedSize();
+#else
+	int size = output.mPosition;
+#endif
 	mFreeOffset += size;
 	mFreeSize -= size;
 	mCurrentCache->mCreatureCount++;
@@ -419,16 +562,27 @@ void GeneratorCache::saveCreature(Generator* gen)
  */
 void GeneratorCache::savePikiheads()
 {
+#if FOR_MODDING
+	CacheStream output(mHeapBuffer + mFreeOffset, mFreeSize, true);
+#else
 	RamStream output(mHeapBuffer + mFreeOffset, mFreeSize);
+#endif
 
 	Iterator<ItemPikihead::Item> iterator(ItemPikihead::mgr);
 	CI_LOOP(iterator)
 	{
 		ItemPikihead::Item* obj = *iterator;
 		if (obj->isAlive() && obj->needSave()) {
+#if FOR_MODDING
+			int size = output.getUsedSize();
+			obj->cacheSave(output);
+			output.flush();
+			int otherSize = output.getUsedSize() - size;
+#else
 			int size = output.mPosition;
 			obj->cacheSave(output);
 			int otherSize = output.mPosition - size;
+#endif
 			mFreeOffset += otherSize;
 			mFreeSize -= otherSize;
 			mCurrentCache->mPikiheadCount++;
@@ -466,6 +620,9 @@ CourseCache::CourseCache(int courseIndex)
 	mCreatureSize   = 0;
 	mPikiheadCount  = 0;
 	mPikiheadSize   = 0;
+#if FOR_MODDING
+	mIsPacked = true;
+#endif
 }
 
 /**
@@ -483,6 +640,9 @@ void CourseCache::beginSave(int offset)
 	mCreatureSize   = 0;
 	mPikiheadCount  = 0;
 	mPikiheadSize   = 0;
+#if FOR_MODDING
+	mIsPacked = true;
+#endif
 }
 
 /**
@@ -491,6 +651,10 @@ void CourseCache::beginSave(int offset)
  */
 void GeneratorCache::write(Stream& output)
 {
+#if FOR_MODDING
+	// only the compact layout records which courses are packed
+	writeCompact(output);
+#else
 	for (int i = 0; i < stageList->getCourseCount(); i++) {
 
 		CourseCache* cache = findCache(mRootCache, i);
@@ -536,6 +700,7 @@ void GeneratorCache::write(Stream& output)
 		}
 		output.textWriteText("\r\n");
 	}
+#endif
 }
 
 /**
@@ -549,8 +714,20 @@ void GeneratorCache::read(Stream& input)
 	CourseCache newcache(-1);
 
 	u32 flag;
+#if FOR_MODDING
+	// compact saves are tagged, legacy saves start straight away with the first course flag
+	u32 firstFlag = input.readByte();
+	if (firstFlag == GENERATOR_CACHE_COMPACT_TAG) {
+		readCompact(input);
+		return;
+	}
+#endif
 	for (int i = 0; i < stageList->getCourseCount(); i++) {
+#if FOR_MODDING
+		flag = (i == 0) ? firstFlag : input.readByte();
+#else
 		flag = input.readByte();
+#endif
 
 		CourseCache* cache = findCache(mFreeCache, i);
 		JUT_ASSERTLINE(1009, cache, "cache %d is not in dead list\n", i);
@@ -665,5 +842,220 @@ void CourseCache::read(Stream& input)
 	mCreatureSize   = input.readInt();
 	mPikiheadCount  = input.readInt();
 	mPikiheadSize   = input.readInt();
+#if FOR_MODDING
+	// legacy saves hold the heap unpacked
+	mIsPacked = false;
+#endif
+}
+
+#if FOR_MODDING
+/**
+ * Writes an unsigned value 7 bits at a time, low bits first.
+ * The top bit of each byte is set when more bytes follow.
+ */
+static void writeVarInt(Stream& output, u32 value)
+{
+	while (value >= 0x80) {
+		output.writeByte((value & 0x7F) | 0x80);
+		value >>= 7;
+	}
+	output.writeByte(value);
+}
+
+/**
+ * Reads a value written by writeVarInt.
+ */
+static u32 readVarInt(Stream& input)
+{
+	u32 value = 0;
+	for (int shift = 0; shift < 32; shift += 7) {
+		u8 byte = input.readByte();
+		value |= (u32)(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) {
+			break;
+		}
+	}
+	return value;
+}
+
+/**
+ * Number of bytes writeVarInt will use for a value.
+ */
+static int getVarIntSize(u32 value)
+{
+	int size = 1;
+	for (; value >= 0x80; value >>= 7) {
+		size++;
+	}
+	return size;
+}
+
+/**
+ * Compact layout, written instead of the legacy layout:
+ *
+ *   u8     GENERATOR_CACHE_COMPACT_TAG
+ *   u8     GENERATOR_CACHE_COMPACT_VERSION
+ *   varint alive course count
+ *   varint used heap size
+ *   per alive course, in heap order:
+ *     varint course index
+ *     CourseCache header (see CourseCache::writeCompact)
+ *   u8[]   used heap bytes
+ *
+ * Dead course headers and the unused tail of the heap are not stored.
+ */
+void GeneratorCache::writeCompact(Stream& output)
+{
+	int startPos   = output.mPosition;
+	int aliveCount = 0;
+	FOREACH_NODE(CourseCache, mRootCache.mChild, cache) { aliveCount++; }
+
+	output.writeByte(GENERATOR_CACHE_COMPACT_TAG);
+	output.writeByte(GENERATOR_CACHE_COMPACT_VERSION);
+	writeVarInt(output, aliveCount);
+	writeVarInt(output, mFreeOffset);
+
+	u32 offset = 0;
+	FOREACH_NODE(CourseCache, mRootCache.mChild, cache)
+	{
+		writeVarInt(output, cache->mCourseIndex);
+		cache->writeCompact(output, offset);
+		offset = cache->mOffset + cache->mSize;
+	}
+
+	if (output.mMode == STREAM_MODE_BINARY) {
+		output._write(mHeapBuffer, mFreeOffset);
+		JUT_ASSERT(output.getStreamDistance(startPos) == getCompactSize(), "generatorCache : compact size mismatch\n");
+	} else {
+		output.writeBytes(mHeapBuffer, mFreeOffset);
+	}
+}
+
+/**
+ * Reads the compact layout. The tag byte has already been consumed by read().
+ */
+void GeneratorCache::readCompact(Stream& input)
+{
+	u8 version = input.readByte();
+	if (version != GENERATOR_CACHE_COMPACT_VERSION) {
+		JUT_PANIC("generatorCache : unknown version (%d)\n", version);
+	}
+
+	u32 aliveCount = readVarInt(input);
+	u32 usedSize   = readVarInt(input);
+	if ((int)usedSize > mHeapSize) {
+		JUT_PANIC("generatorCache : used size %d > heap size %d\n", usedSize, mHeapSize);
+	}
+
+	u32 offset = 0;
+	for (u32 i = 0; i < aliveCount; i++) {
+		int courseIndex    = readVarInt(input);
+		CourseCache* cache = findCache(mFreeCache, courseIndex);
+		if (!cache) {
+			// unknown or repeated course: read its header to stay in step, and leave it out
+			CourseCache skipped(-1);
+			skipped.readCompact(input, offset);
+			offset = skipped.mOffset + skipped.mSize;
+			continue;
+		}
+
+		cache->readCompact(input, offset);
+		offset = cache->mOffset + cache->mSize;
+		if (offset > usedSize) {
+			// points past the stored heap, so keep the course dead rather than read garbage
+			continue;
+		}
+
+		cache->del();
+		mRootCache.add(cache);
+	}
+
+	if (input.mMode == STREAM_MODE_BINARY) {
+		input._read(mHeapBuffer, usedSize);
+	} else {
+		for (u32 i = 0; i < usedSize; i++) {
+			mHeapBuffer[i] = input.readByte();
+		}
+	}
+	mFreeOffset = usedSize;
+	mFreeSize   = mHeapSize - usedSize;
+}
+
+/**
+ * Exact number of bytes writeCompact will produce on a binary stream for the current cache state.
+ */
+int GeneratorCache::getCompactSize()
+{
+	int aliveCount = 0;
+	int size       = 2 + getVarIntSize(mFreeOffset) + mFreeOffset;
+
+	u32 offset = 0;
+	FOREACH_NODE(CourseCache, mRootCache.mChild, cache)
+	{
+		size += getVarIntSize(cache->mCourseIndex) + cache->getCompactSize(offset);
+		offset = cache->mOffset + cache->mSize;
+		aliveCount++;
+	}
+
+	return size + getVarIntSize(aliveCount);
+}
+
+/**
+ * Courses are packed back to back by slideCache, so the offset is normally stored
+ * as a delta from the end of the previous course (usually 0), shifted up one bit.
+ * If a course starts before that end, the low bit is set and the absolute offset
+ * is stored instead, so an out of order heap still round-trips.
+ */
+static u32 packCourseOffset(u32 offset, u32 prevEnd)
+{
+	if (offset < prevEnd) {
+		return (offset << 1) | 1;
+	}
+	return (offset - prevEnd) << 1;
+}
+
+static u32 unpackCourseOffset(u32 value, u32 prevEnd)
+{
+	if (value & 1) {
+		return value >> 1;
+	}
+	return prevEnd + (value >> 1);
+}
+
+/**
+ * mSize is the sum of the three section sizes and is not stored. The sizes are
+ * heap bytes, so they are the packed sizes when mIsPacked is set.
+ */
+void CourseCache::writeCompact(Stream& output, u32 prevEnd)
+{
+	writeVarInt(output, packCourseOffset(mOffset, prevEnd));
+	writeVarInt(output, mGeneratorCount);
+	writeVarInt(output, mGeneratorSize);
+	writeVarInt(output, mCreatureCount);
+	writeVarInt(output, mCreatureSize);
+	writeVarInt(output, mPikiheadCount);
+	writeVarInt(output, mPikiheadSize);
+	output.writeByte(mIsPacked);
+}
+
+void CourseCache::readCompact(Stream& input, u32 prevEnd)
+{
+	mOffset         = unpackCourseOffset(readVarInt(input), prevEnd);
+	mGeneratorCount = readVarInt(input);
+	mGeneratorSize  = readVarInt(input);
+	mCreatureCount  = readVarInt(input);
+	mCreatureSize   = readVarInt(input);
+	mPikiheadCount  = readVarInt(input);
+	mPikiheadSize   = readVarInt(input);
+	mSize           = mGeneratorSize + mCreatureSize + mPikiheadSize;
+	mIsPacked       = input.readByte() != 0;
+}
+
+int CourseCache::getCompactSize(u32 prevEnd)
+{
+	return getVarIntSize(packCourseOffset(mOffset, prevEnd)) + getVarIntSize(mGeneratorCount) + getVarIntSize(mGeneratorSize)
+	     + getVarIntSize(mCreatureCount) + getVarIntSize(mCreatureSize) + getVarIntSize(mPikiheadCount)
+	     + getVarIntSize(mPikiheadSize) + 1;
 }
+#endif
 } // namespace Game
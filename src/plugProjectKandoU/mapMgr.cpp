@@ -520,6 +520,14 @@ void ShapeMapMgr::createTriangles(::Sys::CreateTriangleArg& arg) { mMapCollision
  */
 f32 ShapeMapMgr::getMinY(Vector3f& pos)
 {
+#if FOR_MODDING
+	// map collision read from disc has its top triangle lists, clones fall back to the full search
+	Sys::GridDivider* divider = static_cast<Sys::GridDivider*>(mMapCollision.mDivider);
+	if (divider->mTopTriOffsets) {
+		return divider->getTopY(pos);
+	}
+#endif
+
 	CurrTriInfo info;
 	info.mPosition        = pos;
 	info.mUpdateOnNewMaxY = false;
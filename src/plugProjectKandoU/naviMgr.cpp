@@ -35,6 +35,18 @@ NaviMgr::~NaviMgr()
 	animMgr = nullptr;
 	naviMgr = nullptr;
 
+#if FOR_MODDING
+	// the shared motions and their pose caches die with the section heap and are reloaded by the next
+	// section, so hand the whole budget back
+#if DEBUG
+	if (J3DAnmTransformKey::sSampleCacheSize && J3DAnmTransformKey::sSampleCacheMissNum
+	    && !J3DAnmTransformKey::sSampleCacheHitNum) {
+		OSReport("NaviMgr: pose cache filled %d entries but had no hits\n", J3DAnmTransformKey::sSampleCacheMissNum);
+	}
+#endif
+	J3DAnmTransformKey::resetSampleCacheBudget();
+#endif
+
 	if (mBackupPSMMgr) {
 		delete mBackupPSMMgr;
 		mBackupPSMMgr = nullptr;
@@ -205,7 +217,21 @@ void NaviMgr::load()
 	mOlimarModel = model;
 
 	if (!animMgr) {
+#if FOR_MODDING
+		// pikmin and captains share these motions, and a swarm often plays them on the same frame
+		J3DAnmTransformKey::sSampleCacheMaxSize = 0x4000;
+		J3DAnmTransformKey::sSampleCacheBudget  = 0x20000;
+#endif
 		animMgr = SysShape::AnimMgr::load(texts, "animMgr.txt", model, arc, "motion");
+#if FOR_MODDING
+		J3DAnmTransformKey::sSampleCacheMaxSize = 0;
+#if DEBUG
+		// every section reaches here with a fresh budget, so no caches means it was not handed back
+		if (!J3DAnmTransformKey::sSampleCacheSize) {
+			OSReport("NaviMgr: no pose caches created for the shared motions\n");
+		}
+#endif
+#endif
 	}
 	mCollData = CollPartFactory::load(texts, "naviColl.txt");
 
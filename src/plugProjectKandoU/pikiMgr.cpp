@@ -40,6 +40,10 @@ PikiMgr::PikiMgr()
 
 	allocStorePikmins();
 	mFlags[1] = 0;
+#if FOR_MODDING
+	mHappaDrawMtx  = nullptr;
+	mHappaDrawKind = nullptr;
+#endif
 }
 
 /**
@@ -73,6 +77,10 @@ void PikiMgr::onAlloc()
 	for (int i = 0; i < mMax; i++) {
 		getAt(i)->mMgrIndex = i;
 	}
+#if FOR_MODDING
+	mHappaDrawMtx  = new Mtx[mMax];
+	mHappaDrawKind = new u8[mMax];
+#endif
 }
 
 /**
@@ -309,6 +317,84 @@ void PikiMgr::debugShapeDL(char* text)
 void PikiMgr::doSimpleDraw(Viewport* vp)
 {
 	int vpId = vp->mVpId;
+
+#if FOR_MODDING
+	// Work out each visible piki's happa model and view matrix once, grouped by model, instead of once per model material.
+	// Models with nothing to draw also skip their material setup.
+	int happaNum[PikiHappaCount];
+	int happaStart[PikiHappaCount];
+	for (int i = 0; i < PikiHappaCount; i++) {
+		happaNum[i] = 0;
+	}
+
+	for (int j = 0; j < mMax; j++) {
+		mHappaDrawKind[j] = 0xFF;
+		if (mOpenIds[j]) {
+			continue;
+		}
+
+		Piki* piki = &mArray[j];
+		if (!piki->mLod.isFlag(AILOD_IsVisible) || piki->doped() || !piki->mLod.isVPVisible(vpId)) {
+			continue;
+		}
+
+		int id = piki->getHappa();
+		if ((piki->getKind() == White || piki->getKind() == Purple) && id >= 1) {
+			id += 2;
+		}
+
+		if (id >= 0 && id < PikiHappaCount) {
+			mHappaDrawKind[j] = id;
+			happaNum[id]++;
+		}
+	}
+
+	int start = 0;
+	for (int i = 0; i < PikiHappaCount; i++) {
+		happaStart[i] = start;
+		start += happaNum[i];
+		happaNum[i] = 0;
+	}
+
+	Mtx* viewMtx = &vp->getMatrix(true)->mMatrix.mtxView;
+	for (int j = 0; j < mMax; j++) {
+		int id = mHappaDrawKind[j];
+		if (id == 0xFF) {
+			continue;
+		}
+
+		Matrixf* mtx = mArray[j].mLeafStemJoint->getWorldMatrix();
+		PSMTXConcat(*viewMtx, mtx->mMatrix.mtxView, mHappaDrawMtx[happaStart[id] + happaNum[id]]);
+		happaNum[id]++;
+	}
+
+	for (int i = 0; i < PikiHappaCount; i++) {
+		if (happaNum[i] == 0) {
+			continue;
+		}
+
+		J3DModelData& modelData = *mHappaModel[i];
+		J3DMaterial* mat        = (*modelData.mJointTree.mJoints)->mMaterial;
+
+		j3dSys.mVtxPos   = modelData.getVertexData()->getVtxPosArray();
+		j3dSys.mVtxNorm  = modelData.getVertexData()->getVtxNrmArray();
+		j3dSys.mVtxColor = modelData.getVertexData()->getVtxColorArray(0);
+
+		J3DShape::sOldVcdVatCmd = nullptr;
+
+		Mtx* instMtx = &mHappaDrawMtx[happaStart[i]];
+		for (mat; mat != nullptr; mat = mat->mNext) {
+			mat->loadSharedDL();
+			mat->mShape->loadPreDrawSetting();
+
+			for (int j = 0; j < happaNum[i]; j++) {
+				GXLoadPosMtxImm(instMtx[j], 0);
+				GXLoadNrmMtxImm(instMtx[j], 0);
+				mat->mShape->simpleDrawCache();
+			}
+		}
+	}
+#else
 	for (int i = 0; i < PikiHappaCount; i++) {
 		J3DModelData& modelData = *mHappaModel[i];
 		J3DMaterial* mat        = (*modelData.mJointTree.mJoints)->mMaterial;
@@ -360,6 +446,7 @@ void PikiMgr::doSimpleDraw(Viewport* vp)
 			}
 		}
 	}
+#endif
 }
 
 inline void PikiMgr::updateArrayAt(int i)
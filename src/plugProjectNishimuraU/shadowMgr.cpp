@@ -85,6 +85,9 @@ ShadowNode::ShadowNode()
 	mCreature = nullptr;
 	mMatrices = nullptr;
 	mFlags    = 0;
+#if FOR_MODDING
+	mHashNext = nullptr;
+#endif
 }
 
 /**
@@ -96,6 +99,9 @@ ShadowNode::ShadowNode(Creature* owner, int count)
 	mCreature = owner;
 	mMatrices = new Matrixf[count];
 	mFlags    = 0;
+#if FOR_MODDING
+	mHashNext = nullptr;
+#endif
 	for (int i = 0; i < count; i++) {
 		PSMTXIdentity(mMatrices[i].mMatrix.mtxView);
 	}
@@ -127,6 +133,11 @@ ShadowMgr::ShadowMgr(int count)
 	mCylinderID          = 0;
 	mUnused0             = 0;
 	mName                = "ShadowMgr";
+#if FOR_MODDING
+	for (int i = 0; i < SHADOW_HASH_SIZE; i++) {
+		mShadowHash[i] = nullptr;
+	}
+#endif
 }
 
 /**
@@ -306,6 +317,16 @@ void ShadowMgr::draw(Graphics& gfx, int idx)
  */
 void ShadowMgr::createShadow(Creature* owner)
 {
+#if FOR_MODDING
+	if (findShadowNode(owner)) {
+		return;
+	}
+
+	ShadowNode* newNode = new ShadowNode(owner, getViewportCount());
+	moveShadowNode(newNode, mInactiveShadows);
+	entryShadowNode(newNode);
+	mAllocShadowNum++;
+#else
 	FOREACH_NODE(ShadowNode, mInactiveShadows->getNext(), node)
 	{
 		if (owner == node->mCreature) {
@@ -322,6 +343,7 @@ void ShadowMgr::createShadow(Creature* owner)
 
 	mInactiveShadows->add(new ShadowNode(owner, getViewportCount()));
 	mAllocShadowNum++;
+#endif
 }
 
 /**
@@ -330,6 +352,11 @@ void ShadowMgr::createShadow(Creature* owner)
  */
 void ShadowMgr::killAll()
 {
+#if FOR_MODDING
+	for (int i = 0; i < SHADOW_HASH_SIZE; i++) {
+		mShadowHash[i] = nullptr;
+	}
+#endif
 	mActiveJointShadows->clearRelations();
 	mInactiveJointShadows->clearRelations();
 	mActiveShadows->clearRelations();
@@ -381,6 +408,13 @@ void ShadowMgr::delShadow(Creature* owner)
  */
 void ShadowMgr::addNormalShadow(Creature* owner)
 {
+#if FOR_MODDING
+	ShadowNode* shadow = findShadowNode(owner);
+	if (shadow && shadow->mParent == mInactiveShadows) {
+		moveShadowNode(shadow, mActiveShadows);
+		shadow->init(getViewportCount());
+	}
+#else
 	FOREACH_NODE(ShadowNode, mInactiveShadows->getNext(), node)
 	{
 		if (owner == node->mCreature) {
@@ -390,6 +424,7 @@ void ShadowMgr::addNormalShadow(Creature* owner)
 			return;
 		}
 	}
+#endif
 }
 
 /**
@@ -434,6 +469,12 @@ void ShadowMgr::addHeadJointShadow(Creature*)
  */
 void ShadowMgr::delNormalShadow(Creature* owner)
 {
+#if FOR_MODDING
+	ShadowNode* shadow = findShadowNode(owner);
+	if (shadow && shadow->mParent == mActiveShadows) {
+		moveShadowNode(shadow, mInactiveShadows);
+	}
+#else
 	FOREACH_NODE(ShadowNode, mActiveShadows->mChild, node)
 	{
 		if (owner == node->mCreature) {
@@ -442,6 +483,7 @@ void ShadowMgr::delNormalShadow(Creature* owner)
 			return;
 		}
 	}
+#endif
 }
 
 /**
@@ -468,6 +510,14 @@ void ShadowMgr::delJointShadow(Creature* owner)
  */
 void ShadowMgr::killNormalShadow(Creature* owner)
 {
+#if FOR_MODDING
+	ShadowNode* shadow = findShadowNode(owner);
+	if (shadow) {
+		removeShadowNode(shadow);
+		moveShadowNode(shadow, nullptr);
+		shadow->mCreature = nullptr;
+	}
+#else
 	FOREACH_NODE(ShadowNode, mActiveShadows->mChild, node)
 	{
 		if (owner == node->getGameObject()) {
@@ -483,6 +533,7 @@ void ShadowMgr::killNormalShadow(Creature* owner)
 			node->del();
 		}
 	}
+#endif
 }
 
 /**
@@ -525,6 +576,16 @@ void ShadowMgr::setJointShadowRootNode(JointShadowRootNode* node) { mInactiveJoi
  */
 void ShadowMgr::setForceVisible(Creature* owner, bool isVisible)
 {
+#if FOR_MODDING
+	ShadowNode* shadow = findShadowNode(owner);
+	if (shadow) {
+		if (isVisible) {
+			shadow->mFlags |= 0x10000000;
+		} else {
+			shadow->mFlags &= ~0xF0000000;
+		}
+	}
+#else
 	FOREACH_NODE(ShadowNode, mActiveShadows->mChild, node)
 	{
 		if (owner == node->getGameObject()) {
@@ -550,6 +611,7 @@ void ShadowMgr::setForceVisible(Creature* owner, bool isVisible)
 			}
 		}
 	}
+#endif
 
 	FOREACH_NODE(JointShadowRootNode, mActiveJointShadows->mChild, node)
 	{
@@ -566,6 +628,82 @@ void ShadowMgr::setForceVisible(Creature* owner, bool isVisible)
 	}
 }
 
+#if FOR_MODDING
+static inline u32 getShadowHash(Creature* owner) { return (((u32)owner >> 4) ^ ((u32)owner >> 12)) & (SHADOW_HASH_SIZE - 1); }
+
+/**
+ * Finds the normal shadow node of a creature, active or inactive.
+ */
+ShadowNode* ShadowMgr::findShadowNode(Creature* owner)
+{
+	for (ShadowNode* node = mShadowHash[getShadowHash(owner)]; node; node = node->mHashNext) {
+		if (node->mCreature == owner) {
+			return node;
+		}
+	}
+
+	return nullptr;
+}
+
+/**
+ * Registers a new normal shadow node so it can be found by creature.
+ */
+void ShadowMgr::entryShadowNode(ShadowNode* shadow)
+{
+	u32 hash          = getShadowHash(shadow->mCreature);
+	shadow->mHashNext = mShadowHash[hash];
+	mShadowHash[hash] = shadow;
+}
+
+/**
+ * Unregisters a normal shadow node, before its creature is cleared.
+ */
+void ShadowMgr::removeShadowNode(ShadowNode* shadow)
+{
+	ShadowNode** link = &mShadowHash[getShadowHash(shadow->mCreature)];
+	for (; *link; link = &(*link)->mHashNext) {
+		if (*link == shadow) {
+			*link             = shadow->mHashNext;
+			shadow->mHashNext = nullptr;
+			return;
+		}
+	}
+}
+
+/**
+ * Moves a node to the front of another list (or just unlinks it if list is null) without walking either list.
+ */
+void ShadowMgr::moveShadowNode(ShadowNode* shadow, ShadowNode* list)
+{
+	CNode* parent = shadow->mParent;
+	if (parent) {
+		if (shadow->mPrev) {
+			shadow->mPrev->mNext = shadow->mNext;
+		} else {
+			parent->mChild = shadow->mNext;
+		}
+
+		if (shadow->mNext) {
+			shadow->mNext->mPrev = shadow->mPrev;
+		}
+	}
+
+	shadow->mPrev   = nullptr;
+	shadow->mNext   = nullptr;
+	shadow->mParent = nullptr;
+	if (!list) {
+		return;
+	}
+
+	shadow->mNext = list->mChild;
+	if (list->mChild) {
+		list->mChild->mPrev = shadow;
+	}
+	list->mChild    = shadow;
+	shadow->mParent = list;
+}
+#endif
+
 /**
  * @note Address: 0x802421F0
  * @note Size: 0x30
@@ -27,6 +27,13 @@ FieldVtxColorMgr::FieldVtxColorMgr(J3DModelData* modelData)
     , mControl(nullptr)
     , mSmoothingRate(0.01f)
 {
+#if FOR_MODDING
+	mDirtyInfoStart  = 0;
+	mDirtyInfoEnd    = 0;
+	mDirtyColorStart = 0;
+	mDirtyColorEnd   = 0;
+	mTouchedVtxNum   = 0;
+#endif
 	mModelData = modelData;
 	createFieldVtxColorInfo();
 }
@@ -453,6 +460,36 @@ void FieldVtxColorMgr::calc(J3DVertexBuffer* buffer)
 		GXColor* colorList = *buffer->mVtxColor; // r31
 		bool check         = true;               // r30
 
+#if FOR_MODDING
+		// only infos some control covers can have a non-zero alpha, everything else already settled at 0
+		mTouchedVtxNum = 0;
+		for (int i = mDirtyInfoStart; i < mDirtyInfoEnd; i++) {
+			mInfo[i].mAlpha = 0;
+		}
+
+		FOREACH_NODE(FieldVtxColorControl, mControl, currControl) { updateFieldVtxColorControl(currControl); }
+
+		for (int i = mDirtyInfoStart; i < mDirtyInfoEnd; i++) {
+			u8 alpha       = mInfo[i].mAlpha;
+			GXColor& color = colorList[mInfo[i].mColorIdx];
+			if (color.a == alpha) {
+				continue;
+			}
+
+			if (fabs(color.a - alpha) < 7.0) {
+				color.a = alpha;
+			} else {
+				color.a += (color.a < alpha) ? 7 : -7;
+			}
+
+			mTouchedVtxNum++;
+			check = false;
+		}
+
+		if (mDirtyColorStart < mDirtyColorEnd) {
+			DCStoreRange(&colorList[mDirtyColorStart], (mDirtyColorEnd - mDirtyColorStart) * 4);
+		}
+#else
 		for (int i = 0; i < mInfoCount; i++) {
 			mInfo[i].mAlpha = 0;
 		}
@@ -483,6 +520,7 @@ void FieldVtxColorMgr::calc(J3DVertexBuffer* buffer)
 		}
 
 		DCStoreRange(colorList, buffer->getVertexData()->getColNum() * 4);
+#endif
 		buffer->mCurrentVtxColor = colorList;
 		if (check) {
 			resetFlag(1);
@@ -1269,6 +1307,50 @@ void FieldVtxColorMgr::setupFieldVtxColorControl(Game::FieldVtxColorControl* con
 	control->mRadius      = radius;
 	control->mPower       = power;
 
+#if FOR_MODDING
+	// same as below, but appends through a tail pointer and grows the dirty ranges used by calc
+	FieldVtxColorControlInfo* tail = control->mControlInfo;
+	while (tail && tail->mNext) {
+		tail = tail->mNext;
+	}
+
+	for (int i = 0; i < mInfoCount; i++) {
+		FieldVtxColorInfo* info = &mInfo[i];
+		f32 dist                = pos.distance(vtxPosArray[info->_02]);
+		if (dist >= radius) {
+			continue;
+		}
+
+		FieldVtxColorControlInfo* ctrlInfo = new FieldVtxColorControlInfo(info, dist / radius);
+		if (tail) {
+			tail->mNext = ctrlInfo;
+		} else {
+			control->mControlInfo = ctrlInfo;
+		}
+		tail = ctrlInfo;
+
+		if (mDirtyInfoStart >= mDirtyInfoEnd) {
+			mDirtyInfoStart  = i;
+			mDirtyInfoEnd    = i + 1;
+			mDirtyColorStart = info->mColorIdx;
+			mDirtyColorEnd   = info->mColorIdx + 1;
+			continue;
+		}
+
+		if (i < mDirtyInfoStart) {
+			mDirtyInfoStart = i;
+		}
+		if (i >= mDirtyInfoEnd) {
+			mDirtyInfoEnd = i + 1;
+		}
+		if (info->mColorIdx < mDirtyColorStart) {
+			mDirtyColorStart = info->mColorIdx;
+		}
+		if (info->mColorIdx >= mDirtyColorEnd) {
+			mDirtyColorEnd = info->mColorIdx + 1;
+		}
+	}
+#else
 	for (u16 i = 0; i < mInfoCount; i++) {
 		FieldVtxColorInfo* info = &mInfo[i];
 		Vector3f* vtxPos        = &vtxPosArray[info->_02];
@@ -1298,6 +1380,7 @@ void FieldVtxColorMgr::setupFieldVtxColorControl(Game::FieldVtxColorControl* con
 			nextInfo->mNext = ctrlInfo;
 		}
 	}
+#endif
 
 	/*
 	.loc_0x0:
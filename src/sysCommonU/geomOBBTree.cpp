@@ -1741,6 +1741,11 @@ void OBBTree::read(Stream& input)
 	mTriangleTable = new TriangleTable;
 	mTriangleTable->read(input);
 	getOBB()->read(input);
+
+#if FOR_MODDING
+	// triangle spheres are used as a broad phase by traceMove_new
+	mTriangleTable->createTriangleSphere(*mVertexTable);
+#endif
 }
 
 /**
@@ -1771,6 +1776,11 @@ void OBBTree::readWithoutVerts(Stream& input, Sys::VertexTable& vertTable)
 	mTriangleTable = new TriangleTable;
 	mTriangleTable->read(input);
 	getOBB()->read(input);
+
+#if FOR_MODDING
+	// triangle spheres are used as a broad phase by traceMove_new
+	mTriangleTable->createTriangleSphere(*mVertexTable);
+#endif
 }
 
 /**
@@ -7,6 +7,28 @@
 
 namespace Sys {
 
+#if FOR_MODDING
+/**
+ * Bounding sphere reject run before the full Triangle::intersect, like the map path does with fastIntersect.
+ * Hard intersects accept spheres up to 5 units behind the plane, so the test sphere is padded to match.
+ * Triangle spheres are built when the tree is read. Not used for the _global variants, which run on
+ * clones that share the source tree's triangle table but have transformed vertices.
+ */
+static inline bool isOutOfReach(Game::MoveInfo& moveInfo, Triangle* tri)
+{
+	if (Game::MapMgr::mTraceMoveOptLevel < 1) {
+		return false;
+	}
+
+	Sphere reach(moveInfo.mMoveSphere->mPosition, moveInfo.mMoveSphere->mRadius);
+	if (moveInfo.mDoHardIntersect) {
+		reach.mRadius += 5.0f;
+	}
+
+	return !tri->fastIntersect(reach);
+}
+#endif
+
 /**
  * @note Address: 0x8041FFA8
  * @note Size: 0x1C0
@@ -74,6 +96,11 @@ void OBB::traceMoveTriList_new(Game::MoveInfo& moveInfo, Sys::VertexTable& verte
 
 	for (int i = 0; i < mTriIndexList.getNum(); i++) {
 		Triangle* tri = triangleTable.getTriangle(mTriIndexList.getIndex(i)); // r31
+#if FOR_MODDING
+		if (isOutOfReach(moveInfo, tri)) {
+			continue;
+		}
+#endif
 		Triangle::SphereSweep sweep;
 		sweep.mStartPos         = moveSphere->mPosition;
 		sweep.mSphere.mPosition = moveSphere->mPosition;
@@ -2805,6 +2805,101 @@ lbl_804189A8:
 	*/
 }
 
+#if FOR_MODDING
+/**
+ * Builds the per cell top triangle lists used by getTopY.
+ * Only triangles that insideXZ can accept (normal pointing up) are kept, sorted by their highest vertex.
+ */
+void GridDivider::createTopTriLists()
+{
+	int cellCount  = mMaxX * mMaxZ;
+	mTopTriOffsets = new int[cellCount + 1];
+
+	int total = 0;
+	for (int i = 0; i < cellCount; i++) {
+		mTopTriOffsets[i] = total;
+
+		TriIndexList& triIndexList = mTriIndexLists[i];
+		for (int j = 0; j < triIndexList.getNum(); j++) {
+			if (mTriangleTable->getTriangle(triIndexList.mObjects[j])->mTrianglePlane.mNormal.y > 0.0f) {
+				total++;
+			}
+		}
+	}
+	mTopTriOffsets[cellCount] = total;
+
+	mTopTriIndices = new int[total];
+	mTopTriY       = new f32[total];
+
+	for (int i = 0; i < cellCount; i++) {
+		TriIndexList& triIndexList = mTriIndexLists[i];
+		int start                  = mTopTriOffsets[i];
+		int count                  = 0;
+
+		for (int j = 0; j < triIndexList.getNum(); j++) {
+			int index          = triIndexList.mObjects[j];
+			Triangle* triangle = mTriangleTable->getTriangle(index);
+			if (triangle->mTrianglePlane.mNormal.y <= 0.0f) {
+				continue;
+			}
+
+			f32 topY = mVertexTable->getVertexAt(triangle->mVertices[0]).y;
+			for (int k = 1; k < 3; k++) {
+				f32 y = mVertexTable->getVertexAt(triangle->mVertices[k]).y;
+				if (y > topY) {
+					topY = y;
+				}
+			}
+
+			// insertion sort, highest first
+			int k = start + count;
+			for (; k > start && mTopTriY[k - 1] < topY; k--) {
+				mTopTriY[k]       = mTopTriY[k - 1];
+				mTopTriIndices[k] = mTopTriIndices[k - 1];
+			}
+			mTopTriY[k]       = topY;
+			mTopTriIndices[k] = index;
+			count++;
+		}
+	}
+}
+
+/**
+ * Same result as getCurrTri with mUpdateOnNewMaxY off (the highest surface at pos.xz, or FLOAT_DIST_MIN),
+ * but walks the cell's triangles highest first and stops once no remaining triangle can reach higher.
+ * The height inside a triangle never exceeds its highest vertex; the margin only covers rounding.
+ */
+f32 GridDivider::getTopY(Vector3f& pos)
+{
+	int gridXIndex = static_cast<int>((pos.x - mBoundingBox.mMin.x) / mScaleX);
+	int gridZIndex = static_cast<int>((pos.z - mBoundingBox.mMin.z) / mScaleZ);
+
+	bool withinBounds = (gridXIndex >= 0) && (gridZIndex >= 0) && (gridXIndex < mMaxX) && (gridZIndex < mMaxZ);
+	if (!withinBounds) {
+		return FLOAT_DIST_MIN;
+	}
+
+	int cell = gridZIndex + (gridXIndex * mMaxZ);
+	int end  = mTopTriOffsets[cell + 1];
+
+	bool foundY = false;
+	f32 maxY    = -328000.0f;
+	for (int i = mTopTriOffsets[cell]; i < end; i++) {
+		if (foundY && mTopTriY[i] + 1.0f < maxY) {
+			break;
+		}
+
+		Vector3f point(pos);
+		if (mTriangleTable->getTriangle(mTopTriIndices[i])->insideXZ(point) && point.y > maxY) {
+			maxY   = point.y;
+			foundY = true;
+		}
+	}
+
+	return foundY ? maxY : FLOAT_DIST_MIN;
+}
+#endif
+
 /**
  * @note Address: 0x804189B0
  * @note Size: 0x230
@@ -2868,6 +2963,14 @@ TriIndexList* GridDivider::findTriLists(Sys::Sphere& ball)
 		}
 	}
 
+#if FOR_MODDING
+	// neighbouring queries (e.g. a swarm moving together) usually cover the same cells,
+	// and only this function relinks the cell lists, so the last chain is still intact
+	if (mLastTriList && x_min == mLastMinX && z_start == mLastMinZ && x_stop == mLastMaxX && z_stop == mLastMaxZ) {
+		return mLastTriList;
+	}
+#endif
+
 	TriIndexList* outTriList = nullptr;
 
 	for (int x_ctr = x_min; x_ctr <= x_stop; x_ctr++) {
@@ -2895,6 +2998,14 @@ TriIndexList* GridDivider::findTriLists(Sys::Sphere& ball)
 		outTriList->calcNextCount();
 	}
 
+#if FOR_MODDING
+	mLastMinX    = x_min;
+	mLastMinZ    = z_start;
+	mLastMaxX    = x_stop;
+	mLastMaxZ    = z_stop;
+	mLastTriList = outTriList;
+#endif
+
 	return outTriList;
 	/*
 	stwu     r1, -0x50(r1)
@@ -3500,6 +3611,10 @@ void GridDivider::read(Stream& stream)
 	readIndexList(stream);
 
 	mTriangleTable->createTriangleSphere(*mVertexTable);
+
+#if FOR_MODDING
+	createTopTriLists();
+#endif
 };
 
 /**
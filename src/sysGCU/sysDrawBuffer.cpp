@@ -36,6 +36,12 @@ void DrawBuffer::create(CreateArg& arg)
 	mBuffer            = new J3DDrawBuffer(bufferSize);
 	mBuffer->mSortType = arg.mSortType;
 	mBuffer->mDrawType = arg.mDrawType;
+#if FOR_MODDING
+	// DRAWBUFF_Unk1 buffers are drawn translucent, and the key sort would lose their order
+	if (isFlag(DRAWBUFF_KeySort) && !isFlag(DRAWBUFF_Unk1)) {
+		mBuffer->setKeySort();
+	}
+#endif
 	mDrawType          = mBuffer->mDrawType;
 	mSortType          = mBuffer->mSortType;
 }